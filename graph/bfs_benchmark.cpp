@@ -0,0 +1,254 @@
+/**
+ * @file bfs_benchmark.cpp
+ * @brief A benchmark of the BFS implementations over RMAT graphs (the Graph500 generator), in traversed edges per second (TEPS)
+ *        (a sequential queue-based BFS over the CSR graph, and DirectionOptimizingBFS of direction_optimizing_bfs.hpp in both modes)
+ *        Each search is run from a number of random sources; the traversed edges of a search are the undirected input edges
+ *        of the component of its source, and the rate over the sources is the harmonic mean (as Graph500 reports it).
+ *        Every result is checked against the sequential BFS; the distances must match, and every parent must be a neighbor one level closer.
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread bfs_benchmark.cpp -o bfs_benchmark
+ *                     ./bfs_benchmark [--scale S] [--edge-factor F] [--sources K] [--threads T] [--format csv|json]
+ */
+
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include "compressed_sparse_row_graph.hpp"
+#include "direction_optimizing_bfs.hpp"
+
+// An undirected RMAT graph in the CSR form (each edge stored in both directions)
+struct RmatGraph {
+    std::string name;
+    std::size_t numberOfInputEdges;     // The undirected edges generated (without the self-loops)
+    CsrGraph<std::uint32_t> graph;
+};
+
+// The measured result of a single implementation over a single graph
+struct BenchmarkResult {
+    std::string graphName;
+    std::string implementationName;
+    unsigned int numThreads;
+    std::size_t numberOfSources;
+    double meanMilliseconds;
+    double harmonicMeanGteps;       // Billions of traversed edges per second
+    bool valid;                     // The distances and parents are valid for every source
+};
+
+// Generate an RMAT graph with 2^scale vertices and edgeFactor * 2^scale edges; the seed is fixed so that the graphs are the same across runs (and commits)
+// Each edge picks one quadrant of the adjacency matrix per bit of the vertex IDs with the probabilities (a, b, c, d) = (0.57, 0.19, 0.19, 0.05),
+// which gives the skewed degrees and the small diameter of a social network. The vertex IDs are then shuffled, so the high degree vertices are not clustered.
+RmatGraph generateRmatGraph(unsigned int scale, unsigned int edgeFactor) {
+    const std::uint32_t numberOfVertices = std::uint32_t(1) << scale;
+    const std::size_t numberOfEdges = static_cast<std::size_t>(edgeFactor) * numberOfVertices;
+    std::mt19937_64 randomEngine(20240802);
+    std::uniform_real_distribution<double> probabilityDistribution(0.0, 1.0);
+
+    std::vector<std::uint32_t> permutation(numberOfVertices);
+    for (std::uint32_t vertex = 0; vertex < numberOfVertices; vertex++) {
+        permutation[vertex] = vertex;
+    }
+    std::shuffle(permutation.begin(), permutation.end(), randomEngine);
+
+    RmatGraph rmatGraph;
+    rmatGraph.name = "rmat-s" + std::to_string(scale) + "-ef" + std::to_string(edgeFactor);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+    edges.reserve(2 * numberOfEdges);
+    for (std::size_t index = 0; index < numberOfEdges; index++) {
+        std::uint32_t source = 0, destination = 0;
+        for (unsigned int bit = 0; bit < scale; bit++) {
+            const double probability = probabilityDistribution(randomEngine);
+            const bool isSourceBitSet = probability >= 0.57 + 0.19;                          // Quadrant c or d
+            const bool isDestinationBitSet = (probability >= 0.57 && probability < 0.57 + 0.19) || probability >= 0.57 + 0.19 + 0.19;   // Quadrant b or d
+            source = (source << 1) | (isSourceBitSet ? 1 : 0);
+            destination = (destination << 1) | (isDestinationBitSet ? 1 : 0);
+        }
+        if (source == destination)
+            continue;
+        edges.emplace_back(permutation[source], permutation[destination]);
+        edges.emplace_back(permutation[destination], permutation[source]);
+    }
+    rmatGraph.numberOfInputEdges = edges.size() / 2;
+    rmatGraph.graph = buildCsrGraph(numberOfVertices, edges);
+    return rmatGraph;
+}
+
+// The sequential queue-based BFS, the baseline and the reference of the distances
+std::vector<std::uint32_t> sequentialBfsDistances(const CsrGraph<std::uint32_t>& graph, std::uint32_t sourceVertex) {
+    std::vector<std::uint32_t> distances(graph.getNumberOfVertices(), DirectionOptimizingBFS<std::uint32_t>::UNREACHED);
+    std::vector<std::uint32_t> queue;
+    queue.reserve(graph.getNumberOfVertices());
+    queue.push_back(sourceVertex);
+    distances[sourceVertex] = 0;
+    for (std::size_t readIndex = 0; readIndex < queue.size(); readIndex++) {
+        const std::uint32_t vertex = queue[readIndex];
+        for (std::uint32_t edgeIndex = graph.offsets[vertex]; edgeIndex < graph.offsets[vertex + 1]; edgeIndex++) {
+            const std::uint32_t adjacentVertex = graph.targets[edgeIndex];
+            if (distances[adjacentVertex] == DirectionOptimizingBFS<std::uint32_t>::UNREACHED) {
+                distances[adjacentVertex] = distances[vertex] + 1;
+                queue.push_back(adjacentVertex);
+            }
+        }
+    }
+    return distances;
+}
+
+// Check a BFS result against the reference distances; every reached vertex but the source must have a parent one level closer, adjacent to it
+bool isValidBfsResult(const CsrGraph<std::uint32_t>& graph, std::uint32_t sourceVertex, const BfsResult& result, const std::vector<std::uint32_t>& referenceDistances) {
+    if (result.distances != referenceDistances || result.parents[sourceVertex] != sourceVertex)
+        return false;
+    for (std::uint32_t vertex = 0; vertex < graph.getNumberOfVertices(); vertex++) {
+        if (vertex == sourceVertex || result.distances[vertex] == DirectionOptimizingBFS<std::uint32_t>::UNREACHED)
+            continue;
+        const std::uint32_t parent = result.parents[vertex];
+        if (parent >= graph.getNumberOfVertices() || result.distances[parent] + 1 != result.distances[vertex])
+            return false;
+        const std::uint32_t* firstNeighbor = graph.targets.data() + graph.offsets[parent];
+        const std::uint32_t* lastNeighbor = graph.targets.data() + graph.offsets[parent + 1];
+        if (std::find(firstNeighbor, lastNeighbor, vertex) == lastNeighbor)
+            return false;
+    }
+    return true;
+}
+
+// Run every implementation over a graph, from the same random sources (with at least one edge each)
+std::vector<BenchmarkResult> benchmarkGraph(const RmatGraph& rmatGraph, std::size_t numberOfSources, unsigned int numThreads) {
+    const CsrGraph<std::uint32_t>& graph = rmatGraph.graph;
+    std::mt19937_64 randomEngine(20240803);
+    std::uniform_int_distribution<std::uint32_t> vertexDistribution(0, graph.getNumberOfVertices() - 1);
+    std::vector<std::uint32_t> sources;
+    while (sources.size() < numberOfSources) {
+        std::uint32_t vertex = vertexDistribution(randomEngine);
+        if (graph.getDegree(vertex) > 0) {
+            sources.push_back(vertex);
+        }
+    }
+
+    // The reference distances and the traversed edges of each source (half the degrees of its component)
+    std::vector<std::vector<std::uint32_t>> referenceDistances;
+    std::vector<double> traversedEdges;
+    std::vector<double> sequentialMilliseconds;
+    for (std::uint32_t sourceVertex : sources) {
+        auto startTime = std::chrono::steady_clock::now();
+        referenceDistances.push_back(sequentialBfsDistances(graph, sourceVertex));
+        sequentialMilliseconds.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+        std::size_t degreeSum = 0;
+        for (std::uint32_t vertex = 0; vertex < graph.getNumberOfVertices(); vertex++) {
+            if (referenceDistances.back()[vertex] != DirectionOptimizingBFS<std::uint32_t>::UNREACHED) {
+                degreeSum += graph.getDegree(vertex);
+            }
+        }
+        traversedEdges.push_back(static_cast<double>(degreeSum) / 2);
+    }
+
+    // Summarize the runtimes of the sources into a result
+    auto summarize = [&](const std::string& implementationName, unsigned int implementationThreads, const std::vector<double>& runtimes, bool valid) {
+        double totalMilliseconds = 0, inverseRateSum = 0;
+        for (std::size_t index = 0; index < runtimes.size(); index++) {
+            totalMilliseconds += runtimes[index];
+            inverseRateSum += (runtimes[index] / 1000) / (traversedEdges[index] / 1e9);
+        }
+        return BenchmarkResult{rmatGraph.name, implementationName, implementationThreads, runtimes.size(),
+                               totalMilliseconds / runtimes.size(), runtimes.size() / inverseRateSum, valid};
+    };
+
+    std::vector<BenchmarkResult> results;
+    results.push_back(summarize("sequential", 1, sequentialMilliseconds, true));
+
+    DirectionOptimizingBFS<std::uint32_t> bfs(graph, graph, numThreads);
+    for (BfsMode mode : {BfsMode::TopDown, BfsMode::DirectionOptimizing}) {
+        std::vector<double> runtimes;
+        bool valid = true;
+        for (std::size_t index = 0; index < sources.size(); index++) {
+            auto startTime = std::chrono::steady_clock::now();
+            BfsResult result = bfs.search(sources[index], mode);
+            runtimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+            valid = valid && isValidBfsResult(graph, sources[index], result, referenceDistances[index]);
+        }
+        results.push_back(summarize(mode == BfsMode::TopDown ? "top-down" : "direction-optimizing", numThreads, runtimes, valid));
+    }
+    return results;
+}
+
+int main(int argc, char* argv[]) {
+    std::string outputFormat = "csv";
+    unsigned int scale = 0;
+    unsigned int edgeFactor = 16;
+    std::size_t numberOfSources = 16;
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    for (int index = 1; index < argc; index++) {
+        std::string argument = argv[index];
+        if (argument == "--scale" && index + 1 < argc) {
+            scale = static_cast<unsigned int>(std::strtoul(argv[++index], nullptr, 10));
+        } else if (argument == "--edge-factor" && index + 1 < argc) {
+            edgeFactor = static_cast<unsigned int>(std::strtoul(argv[++index], nullptr, 10));
+        } else if (argument == "--sources" && index + 1 < argc) {
+            numberOfSources = static_cast<std::size_t>(std::strtoull(argv[++index], nullptr, 10));
+        } else if (argument == "--threads" && index + 1 < argc) {
+            numThreads = static_cast<unsigned int>(std::strtoul(argv[++index], nullptr, 10));
+        } else if (argument == "--format" && index + 1 < argc) {
+            outputFormat = argv[++index];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--scale S] [--edge-factor F] [--sources K] [--threads T] [--format csv|json]" << std::endl;
+            return 1;
+        }
+    }
+    if ((outputFormat != "csv" && outputFormat != "json") || scale > 31 || edgeFactor == 0 || numberOfSources == 0) {
+        std::cerr << "The format must be csv or json, the scale at most 31, and the edge factor and the number of sources positive" << std::endl;
+        return 1;
+    }
+    if (numThreads == 0) {
+        numThreads = 1;
+    }
+
+    std::vector<unsigned int> scales;
+    if (scale != 0) {
+        scales.push_back(scale);
+    } else {
+        scales = {16, 18, 20};
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (unsigned int graphScale : scales) {
+        RmatGraph rmatGraph = generateRmatGraph(graphScale, edgeFactor);
+        std::vector<BenchmarkResult> graphResults = benchmarkGraph(rmatGraph, numberOfSources, numThreads);
+        results.insert(results.end(), graphResults.begin(), graphResults.end());
+    }
+
+    if (outputFormat == "csv") {
+        std::cout << "graph,implementation,threads,sources,mean_runtime_ms,gteps,valid" << std::endl;
+        for (const BenchmarkResult& result : results) {
+            std::cout << result.graphName << ',' << result.implementationName << ',' << result.numThreads << ',' << result.numberOfSources << ','
+                      << result.meanMilliseconds << ',' << result.harmonicMeanGteps << ',' << (result.valid ? "true" : "false") << std::endl;
+        }
+    } else {
+        std::cout << "[" << std::endl;
+        for (std::size_t index = 0; index < results.size(); index++) {
+            const BenchmarkResult& result = results[index];
+            std::cout << "  {\"graph\": \"" << result.graphName << "\", \"implementation\": \"" << result.implementationName << "\""
+                      << ", \"threads\": " << result.numThreads << ", \"sources\": " << result.numberOfSources
+                      << ", \"mean_runtime_ms\": " << result.meanMilliseconds << ", \"gteps\": " << result.harmonicMeanGteps
+                      << ", \"valid\": " << (result.valid ? "true" : "false") << "}" << (index + 1 < results.size() ? "," : "") << std::endl;
+        }
+        std::cout << "]" << std::endl;
+    }
+
+    return 0;
+}
+
+// $ ./bfs_benchmark
+// graph,implementation,threads,sources,mean_runtime_ms,gteps,valid
+// rmat-s16-ef16,sequential,1,16,6.93742,0.151079,true
+// rmat-s16-ef16,top-down,1,16,9.88015,0.106081,true
+// rmat-s16-ef16,direction-optimizing,1,16,3.36455,0.311513,true
+// ...
+// rmat-s20-ef16,sequential,1,16,278.689,0.0601954,true
+// rmat-s20-ef16,top-down,1,16,392.963,0.0426906,true
+// rmat-s20-ef16,direction-optimizing,1,16,62.6647,0.267708,true
+// (Measured on a single core; the runtimes vary by machine, the validity does not)
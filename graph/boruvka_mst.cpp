@@ -0,0 +1,39 @@
+/**
+ * @file boruvka_mst.cpp
+ * @brief Borůvka's Minimum Spanning Tree Algorithm implementation in C++ language (see boruvka_mst.hpp)
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread boruvka_mst.cpp -o boruvka_mst
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include "boruvka_mst.hpp"
+
+int main(void) {
+    // The same graph as kruskal_mst.cpp, with 4 worker threads
+    BoruvkaMSTGraph graph(4, 4);    // A graph with 4 vertices
+    graph.addEdge(1, 2, 2);
+    graph.addEdge(1, 3, 4);
+    graph.addEdge(2, 3, 5);
+    graph.addEdge(2, 4, 7);
+    graph.addEdge(3, 4, 10);
+
+    std::vector<Edge> mstEdges = graph.findMST();
+
+    double minimumSpanningTreeWeight = 0;
+    std::cout << "Following are the edges in the constructed MST" << std::endl;
+    for (const Edge& edge : mstEdges) {
+        minimumSpanningTreeWeight += edge.weight;
+        std::cout << "(" << edge.source + 1 << ", " << edge.destination + 1 << ") => Cost: " << edge.weight << std::endl;
+    }
+    std::cout << "Minimum Spanning Tree Weight: " << minimumSpanningTreeWeight << std::endl;
+
+    return 0;
+}
+
+// Following are the edges in the constructed MST
+// (1, 2) => Cost: 2
+// (1, 3) => Cost: 4
+// (2, 4) => Cost: 7
+// Minimum Spanning Tree Weight: 13
@@ -0,0 +1,156 @@
+/**
+ * @file boruvka_mst.hpp
+ * @brief Borůvka's Minimum Spanning Tree Algorithm implementation in C++ language, parallelized over threads
+ *        Each round, every component finds its cheapest outgoing edge (in parallel over the edges), the components are contracted
+ *        along those edges with a concurrent (lock-free) disjoint set (concurrent_disjoint_set.hpp), and the edges inside a component (self-loops) are filtered out.
+ *        The number of components at least halves every round, so there are at most log2(V) rounds.
+ *        It takes the same edge list as KruskalMSTGraph (kruskal_mst.hpp) and finds the same MST.
+ *        It is shared by boruvka_mst.cpp (example) and mst_benchmark.cpp (benchmark).
+ */
+
+#ifndef BORUVKA_MST_HPP
+#define BORUVKA_MST_HPP
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+#include "kruskal_mst.hpp"
+#include "concurrent_disjoint_set.hpp"
+
+// A graph class with Borůvka's MST algorithm
+class BoruvkaMSTGraph {
+private:
+    std::vector<Edge> edges;
+    unsigned int numberOfVertices;
+    unsigned int numThreads;
+
+    void parallelFor(std::size_t count, const std::function<void(unsigned int, std::size_t, std::size_t)>& body) const;
+
+public:
+    BoruvkaMSTGraph(unsigned int numberOfVertices, unsigned int numThreads = std::thread::hardware_concurrency()) {
+        this->numberOfVertices = numberOfVertices;
+        this->numThreads = (numThreads == 0) ? 1 : numThreads;
+    }
+
+    void addEdge(int source, int destination, double weight);
+    std::vector<Edge> findMST();
+};
+
+// Function to add an edge to the graph
+inline void BoruvkaMSTGraph::addEdge(int source, int destination, double weight) {
+    // Note that the vertices array is 0-based
+    this->edges.push_back(Edge(source - 1, destination - 1, weight));
+}
+
+// Helper method to split [0, count) into one contiguous chunk per thread and run body(threadIndex, begin, end) on each
+inline void BoruvkaMSTGraph::parallelFor(std::size_t count, const std::function<void(unsigned int, std::size_t, std::size_t)>& body) const {
+    unsigned int numChunks = static_cast<unsigned int>(std::min<std::size_t>(this->numThreads, std::max<std::size_t>(count / 4096, 1)));
+    std::vector<std::thread> threads;
+    for (unsigned int chunkIndex = 1; chunkIndex < numChunks; chunkIndex++) {
+        threads.emplace_back(body, chunkIndex, count * chunkIndex / numChunks, count * (chunkIndex + 1) / numChunks);
+    }
+    body(0, 0, count / numChunks);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Borůvka's Algorithm to find the Minimum Spanning Tree (a minimum spanning forest if the graph is disconnected)
+// Edges are totally ordered by (weight, insertion order), so the MST is unique; it is the same one KruskalMSTGraph::findMST finds.
+// The MST edges are returned in the order of the rounds they are found in.
+inline std::vector<Edge> BoruvkaMSTGraph::findMST() {
+    const std::uint32_t NO_EDGE = UINT32_MAX;
+    auto isLighter = [this](std::uint32_t edgeIndex1, std::uint32_t edgeIndex2) {
+        const double weight1 = this->edges[edgeIndex1].weight, weight2 = this->edges[edgeIndex2].weight;
+        return weight1 < weight2 || (weight1 == weight2 && edgeIndex1 < edgeIndex2);
+    };
+
+    ConcurrentDisjointSet disjointSet(this->numberOfVertices);
+    std::vector<std::atomic<std::uint32_t>> cheapestEdges(this->numberOfVertices);     // The cheapest outgoing edge of each component root
+
+    // The edges that may still connect two components; the others are dropped for good
+    std::vector<std::uint32_t> activeEdges(this->edges.size());
+    for (std::size_t index = 0; index < this->edges.size(); index++) {
+        activeEdges[index] = static_cast<std::uint32_t>(index);
+    }
+
+    std::vector<Edge> mstEdges;
+    std::vector<std::vector<std::uint32_t>> remainingEdgesPerThread(this->numThreads);
+    std::vector<std::vector<std::uint32_t>> mstEdgesPerThread(this->numThreads);
+    while (!activeEdges.empty()) {
+        parallelFor(this->numberOfVertices, [&](unsigned int, std::size_t begin, std::size_t end) {
+            for (std::size_t vertex = begin; vertex < end; vertex++) {
+                cheapestEdges[vertex].store(NO_EDGE, std::memory_order_relaxed);
+            }
+        });
+
+        // (A thread may get no chunk when there is little work left, so every per-thread list is cleared here)
+        for (unsigned int threadIndex = 0; threadIndex < this->numThreads; threadIndex++) {
+            remainingEdgesPerThread[threadIndex].clear();
+            mstEdgesPerThread[threadIndex].clear();
+        }
+
+        // 1. Find the cheapest outgoing edge of each component, filtering out the self-loops of the contracted graph
+        parallelFor(activeEdges.size(), [&](unsigned int threadIndex, std::size_t begin, std::size_t end) {
+            std::vector<std::uint32_t>& remainingEdges = remainingEdgesPerThread[threadIndex];
+            for (std::size_t index = begin; index < end; index++) {
+                const std::uint32_t edgeIndex = activeEdges[index];
+                const std::uint32_t sourceRoot = disjointSet.findParentVertex(this->edges[edgeIndex].source);
+                const std::uint32_t destinationRoot = disjointSet.findParentVertex(this->edges[edgeIndex].destination);
+                if (sourceRoot == destinationRoot)
+                    continue;
+                remainingEdges.push_back(edgeIndex);
+
+                for (std::uint32_t root : {sourceRoot, destinationRoot}) {
+                    std::uint32_t currentEdgeIndex = cheapestEdges[root].load(std::memory_order_relaxed);
+                    while ((currentEdgeIndex == NO_EDGE || isLighter(edgeIndex, currentEdgeIndex)) &&
+                           !cheapestEdges[root].compare_exchange_weak(currentEdgeIndex, edgeIndex, std::memory_order_relaxed)) {
+                    }
+                }
+            }
+        });
+
+        activeEdges.clear();
+        for (const std::vector<std::uint32_t>& remainingEdges : remainingEdgesPerThread) {
+            activeEdges.insert(activeEdges.end(), remainingEdges.begin(), remainingEdges.end());
+        }
+        if (activeEdges.empty())
+            break;
+
+        // 2. Add the cheapest edge of every component to the MST
+        // When two components choose the same edge, only the one with the smaller root adds it, so every MST edge is added once.
+        parallelFor(this->numberOfVertices, [&](unsigned int threadIndex, std::size_t begin, std::size_t end) {
+            std::vector<std::uint32_t>& foundMstEdges = mstEdgesPerThread[threadIndex];
+            for (std::size_t root = begin; root < end; root++) {
+                const std::uint32_t edgeIndex = cheapestEdges[root].load(std::memory_order_relaxed);
+                if (edgeIndex == NO_EDGE)
+                    continue;
+                const std::uint32_t sourceRoot = disjointSet.findParentVertex(this->edges[edgeIndex].source);
+                const std::uint32_t otherRoot = (sourceRoot == root) ? disjointSet.findParentVertex(this->edges[edgeIndex].destination) : sourceRoot;
+                if (cheapestEdges[otherRoot].load(std::memory_order_relaxed) == edgeIndex && otherRoot < root)
+                    continue;
+                foundMstEdges.push_back(edgeIndex);
+            }
+        });
+
+        // 3. Contract the components along the new MST edges
+        std::size_t firstRoundEdge = mstEdges.size();
+        for (const std::vector<std::uint32_t>& foundMstEdges : mstEdgesPerThread) {
+            for (std::uint32_t edgeIndex : foundMstEdges) {
+                mstEdges.push_back(this->edges[edgeIndex]);
+            }
+        }
+        parallelFor(mstEdges.size() - firstRoundEdge, [&](unsigned int, std::size_t begin, std::size_t end) {
+            for (std::size_t index = firstRoundEdge + begin; index < firstRoundEdge + end; index++) {
+                disjointSet.unite(mstEdges[index].source, mstEdges[index].destination);
+            }
+        });
+    }
+
+    return mstEdges;
+}
+
+#endif // BORUVKA_MST_HPP
@@ -0,0 +1,90 @@
+/**
+ * @file compressed_sparse_row_graph.cpp
+ * @brief Examples of the compressed sparse row (CSR) graph of compressed_sparse_row_graph.hpp; building it from an edge list,
+ *        BFS / DFS over it (the graph of breadth_first_search_via_adjacent_list.c), and the MST algorithms taking it as input
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "compressed_sparse_row_graph.hpp"
+#include "prim_mst_via_priority_queue.hpp"
+#include "kruskal_mst.hpp"
+
+// A helper method to print a list of vertices as "VERTEX a -> VERTEX b -> ... END"
+void displayVisitOrder(const std::vector<std::uint32_t>& order) {
+    for (std::uint32_t vertex : order) {
+        std::cout << "VERTEX " << vertex << " -> ";
+    }
+    std::cout << "END" << std::endl;
+}
+
+int main(void) {
+    // The directed graph with 5 vertices of breadth_first_search_via_adjacent_list.c
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {{0, 1}, {0, 2}, {1, 2}, {2, 0}, {2, 3}, {3, 3}, {3, 4}};
+    CsrGraph<std::uint32_t> graph = buildCsrGraph(5, edges);
+
+    // The whole graph is two arrays
+    std::cout << "offsets: ";
+    for (std::uint32_t offset : graph.offsets) {
+        std::cout << offset << " ";
+    }
+    std::cout << std::endl << "targets: ";
+    for (std::uint32_t target : graph.targets) {
+        std::cout << target << " ";
+    }
+    std::cout << std::endl;
+    for (std::uint32_t vertex = 0; vertex < graph.getNumberOfVertices(); vertex++) {
+        std::cout << "VERTEX " << vertex << " -> ";
+        for (std::uint32_t edgeIndex = graph.offsets[vertex]; edgeIndex < graph.offsets[vertex + 1]; edgeIndex++) {
+            std::cout << graph.targets[edgeIndex] << " ";
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "BFS from vertex 2: ";
+    displayVisitOrder(breadthFirstSearchOrder(graph, 2));
+    std::cout << "BFS from vertex 0: ";
+    displayVisitOrder(breadthFirstSearchOrder(graph, 0));
+    std::cout << "DFS from vertex 0: ";
+    displayVisitOrder(depthFirstSearchOrder(graph, 0));
+
+    // An undirected weighted graph (each edge in both directions) as the input of Prim's and Kruskal's Algorithms
+    std::vector<WeightedEdge<double>> weightedEdges;
+    std::vector<WeightedEdge<double>> undirectedEdges = {{0, 1, 2}, {0, 3, 6}, {1, 2, 3}, {1, 3, 8}, {1, 4, 5}, {2, 4, 7}, {3, 4, 9}};
+    for (const WeightedEdge<double>& edge : undirectedEdges) {
+        weightedEdges.push_back(edge);
+        weightedEdges.push_back(WeightedEdge<double>{edge.destination, edge.source, edge.weight});
+    }
+    CsrGraph<double> weightedGraph = buildCsrGraph(5, weightedEdges);
+
+    double primTotalWeight = 0;
+    for (const WeightedEdge<double>& edge : primMST(weightedGraph, 0)) {
+        primTotalWeight += edge.weight;
+    }
+    KruskalMSTGraph kruskalGraph(weightedGraph.getNumberOfVertices());
+    kruskalGraph.addEdges(weightedGraph);
+    double kruskalTotalWeight = 0;
+    for (const Edge& edge : kruskalGraph.findMST()) {
+        kruskalTotalWeight += edge.weight;
+    }
+    std::cout << "Total Weight of MST (Prim): " << primTotalWeight << std::endl;
+    std::cout << "Total Weight of MST (Kruskal): " << kruskalTotalWeight << std::endl;
+
+    return 0;
+}
+
+// offsets: 0 2 3 5 7 7
+// targets: 1 2 2 0 3 3 4
+// VERTEX 0 -> 1 2
+// VERTEX 1 -> 2
+// VERTEX 2 -> 0 3
+// VERTEX 3 -> 3 4
+// VERTEX 4 ->
+// BFS from vertex 2: VERTEX 2 -> VERTEX 0 -> VERTEX 3 -> VERTEX 1 -> VERTEX 4 -> END
+// BFS from vertex 0: VERTEX 0 -> VERTEX 1 -> VERTEX 2 -> VERTEX 3 -> VERTEX 4 -> END
+// DFS from vertex 0: VERTEX 0 -> VERTEX 1 -> VERTEX 2 -> VERTEX 3 -> VERTEX 4 -> END
+// Total Weight of MST (Prim): 16
+// Total Weight of MST (Kruskal): 16
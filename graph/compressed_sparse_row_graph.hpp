@@ -0,0 +1,195 @@
+/**
+ * @file compressed_sparse_row_graph.hpp
+ * @brief Compressed sparse row (CSR) graph implementation in C++ language, with a counting sort builder and BFS / DFS over it
+ *        Unlike the linked adjacency lists (graph_via_adjacent_list_dynamic.c), where every neighbor is a malloc'd node and so a cache miss,
+ *        the neighbors of a vertex are a contiguous slice of one array; a graph costs 4 bytes per vertex and 4 bytes per edge
+ *        (plus the weights, if any), so one billion edges fit in about 4 GB.
+ *        It is shared by compressed_sparse_row_graph.cpp (example) and the graph algorithms taking a CSR graph as input
+ *        (e.g. prim_mst_via_priority_queue.hpp, kruskal_mst.hpp).
+ */
+
+#ifndef COMPRESSED_SPARSE_ROW_GRAPH_HPP
+#define COMPRESSED_SPARSE_ROW_GRAPH_HPP
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+// A graph in the compressed sparse row (CSR) form over dense vertex IDs (0, 1, ..., n - 1)
+// The outgoing edges of vertex v are targets[offsets[v]] ... targets[offsets[v + 1] - 1] (with the same indices for weights),
+// so the neighbors of a vertex are contiguous in memory, instead of being scattered over hash map nodes and strings.
+// The edge indices are 32-bit, so a graph holds up to 2^32 - 1 edges. An unweighted graph leaves weights empty.
+template <typename EdgeWeightType>
+struct CsrGraph {
+    std::vector<std::uint32_t> offsets;         // offsets[v] is the index of the first outgoing edge of v (size: n + 1)
+    std::vector<std::uint32_t> targets;         // Destination vertex of each edge
+    std::vector<EdgeWeightType> weights;        // Weight of each edge (empty for an unweighted graph)
+
+    std::uint32_t getNumberOfVertices() const { return static_cast<std::uint32_t>(offsets.size() - 1); }
+    std::size_t getNumberOfEdges() const { return targets.size(); }
+    std::uint32_t getDegree(std::uint32_t vertex) const { return offsets[vertex + 1] - offsets[vertex]; }
+};
+
+// An edge of a graph given as an edge list (the input of buildCsrGraph) or of a minimum spanning tree (the output of primMST)
+template <typename EdgeWeightType>
+struct WeightedEdge {
+    std::uint32_t source;
+    std::uint32_t destination;
+    EdgeWeightType weight;
+};
+
+// Helper functions to read the endpoints of an edge of either kind of edge list
+template <typename EdgeWeightType>
+inline std::uint32_t getEdgeSource(const WeightedEdge<EdgeWeightType>& edge) { return edge.source; }
+template <typename EdgeWeightType>
+inline std::uint32_t getEdgeDestination(const WeightedEdge<EdgeWeightType>& edge) { return edge.destination; }
+inline std::uint32_t getEdgeSource(const std::pair<std::uint32_t, std::uint32_t>& edge) { return edge.first; }
+inline std::uint32_t getEdgeDestination(const std::pair<std::uint32_t, std::uint32_t>& edge) { return edge.second; }
+
+// Helper function to lay out the offsets of a CSR graph via counting sort (by the source vertex), and to check the edge list
+// On return, the offsets are shifted up by one slot (offsets[v + 1] is the index of the first outgoing edge of v, and there are n + 2 of them).
+// The scatter loop of the builder bumps offsets[source + 1] for every edge it places, which leaves the final offsets in place
+// (then the last one is dropped), so no separate array of n cursors is needed.
+template <typename EdgeWeightType, typename EdgeType>
+CsrGraph<EdgeWeightType> layOutCsrGraph(std::uint32_t numberOfVertices, const std::vector<EdgeType>& edges) {
+    if (edges.size() > UINT32_MAX) {
+        throw std::length_error("Too many edges for 32-bit edge indices");
+    }
+
+    CsrGraph<EdgeWeightType> graph;
+    graph.offsets.assign(static_cast<std::size_t>(numberOfVertices) + 2, 0);
+    graph.targets.resize(edges.size());
+
+    // Count the outgoing edges of each vertex (shifted by 2), then turn the counts into the starting offsets (prefix sum, shifted by 1)
+    for (const EdgeType& edge : edges) {
+        if (getEdgeSource(edge) >= numberOfVertices || getEdgeDestination(edge) >= numberOfVertices) {
+            throw std::out_of_range("Invalid vertex ID in the edge list");
+        }
+        graph.offsets[getEdgeSource(edge) + 2]++;
+    }
+    for (std::uint32_t vertex = 0; vertex < numberOfVertices; vertex++) {
+        graph.offsets[vertex + 2] += graph.offsets[vertex + 1];
+    }
+    return graph;
+}
+
+// Function to build a weighted CSR graph from an edge list via counting sort (by the source vertex) in O(n + m)
+// Each edge is directed as given; pass both directions for an undirected graph.
+// The sort is stable, so the neighbors of a vertex keep the order of the edge list.
+template <typename EdgeWeightType>
+CsrGraph<EdgeWeightType> buildCsrGraph(std::uint32_t numberOfVertices, const std::vector<WeightedEdge<EdgeWeightType>>& edges) {
+    CsrGraph<EdgeWeightType> graph = layOutCsrGraph<EdgeWeightType>(numberOfVertices, edges);
+    graph.weights.resize(edges.size());
+
+    // Scatter the edges into their slots
+    for (const WeightedEdge<EdgeWeightType>& edge : edges) {
+        std::uint32_t slot = graph.offsets[edge.source + 1]++;
+        graph.targets[slot] = edge.destination;
+        graph.weights[slot] = edge.weight;
+    }
+    graph.offsets.pop_back();
+    return graph;
+}
+
+// Function to build an unweighted CSR graph from an edge list of (source, destination) pairs, in the same way
+template <typename EdgeWeightType = std::uint32_t>
+CsrGraph<EdgeWeightType> buildCsrGraph(std::uint32_t numberOfVertices, const std::vector<std::pair<std::uint32_t, std::uint32_t>>& edges) {
+    CsrGraph<EdgeWeightType> graph = layOutCsrGraph<EdgeWeightType>(numberOfVertices, edges);
+
+    // Scatter the edges into their slots
+    for (const std::pair<std::uint32_t, std::uint32_t>& edge : edges) {
+        graph.targets[graph.offsets[edge.first + 1]++] = edge.second;
+    }
+    graph.offsets.pop_back();
+    return graph;
+}
+
+// Function to build the transposed graph (every edge u -> v turned into v -> u), i.e. the incoming edges of each vertex, in O(n + m)
+// The same counting sort, by the destination vertex; the incoming edges of a vertex are in the order of their sources.
+template <typename EdgeWeightType>
+CsrGraph<EdgeWeightType> transposeCsrGraph(const CsrGraph<EdgeWeightType>& graph) {
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+    const bool isWeighted = !graph.weights.empty();
+    CsrGraph<EdgeWeightType> transposedGraph;
+    transposedGraph.offsets.assign(static_cast<std::size_t>(numberOfVertices) + 2, 0);
+    transposedGraph.targets.resize(graph.targets.size());
+    if (isWeighted) {
+        transposedGraph.weights.resize(graph.weights.size());
+    }
+
+    for (std::uint32_t target : graph.targets) {
+        transposedGraph.offsets[target + 2]++;
+    }
+    for (std::uint32_t vertex = 0; vertex < numberOfVertices; vertex++) {
+        transposedGraph.offsets[vertex + 2] += transposedGraph.offsets[vertex + 1];
+    }
+    for (std::uint32_t source = 0; source < numberOfVertices; source++) {
+        for (std::uint32_t edgeIndex = graph.offsets[source]; edgeIndex < graph.offsets[source + 1]; edgeIndex++) {
+            std::uint32_t slot = transposedGraph.offsets[graph.targets[edgeIndex] + 1]++;
+            transposedGraph.targets[slot] = source;
+            if (isWeighted) {
+                transposedGraph.weights[slot] = graph.weights[edgeIndex];
+            }
+        }
+    }
+    transposedGraph.offsets.pop_back();
+    return transposedGraph;
+}
+
+// Function to visit the vertices reachable from sourceVertex in Breadth First Search (BFS) order
+// The queue is the output array itself; the vertices between the read and the write positions are the ones still to visit.
+template <typename EdgeWeightType>
+std::vector<std::uint32_t> breadthFirstSearchOrder(const CsrGraph<EdgeWeightType>& graph, std::uint32_t sourceVertex) {
+    if (sourceVertex >= graph.getNumberOfVertices()) {
+        throw std::out_of_range("Invalid source vertex");
+    }
+    std::vector<bool> visited(graph.getNumberOfVertices(), false);
+    std::vector<std::uint32_t> order;
+    order.push_back(sourceVertex);
+    visited[sourceVertex] = true;
+    for (std::size_t readIndex = 0; readIndex < order.size(); readIndex++) {
+        std::uint32_t currentVertex = order[readIndex];
+        for (std::uint32_t edgeIndex = graph.offsets[currentVertex]; edgeIndex < graph.offsets[currentVertex + 1]; edgeIndex++) {
+            std::uint32_t adjacentVertex = graph.targets[edgeIndex];
+            if (!visited[adjacentVertex]) {
+                visited[adjacentVertex] = true;
+                order.push_back(adjacentVertex);
+            }
+        }
+    }
+    return order;
+}
+
+// Function to visit the vertices reachable from sourceVertex in Depth First Search (DFS) order
+// Iterative with an explicit stack of (vertex, next edge index) frames, so the order is the one of the recursive version,
+// but a deep graph (e.g. a path of millions of vertices) cannot overflow the call stack.
+template <typename EdgeWeightType>
+std::vector<std::uint32_t> depthFirstSearchOrder(const CsrGraph<EdgeWeightType>& graph, std::uint32_t sourceVertex) {
+    if (sourceVertex >= graph.getNumberOfVertices()) {
+        throw std::out_of_range("Invalid source vertex");
+    }
+    std::vector<bool> visited(graph.getNumberOfVertices(), false);
+    std::vector<std::uint32_t> order;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> stack;
+    order.push_back(sourceVertex);
+    visited[sourceVertex] = true;
+    stack.push_back(std::make_pair(sourceVertex, graph.offsets[sourceVertex]));
+    while (!stack.empty()) {
+        std::pair<std::uint32_t, std::uint32_t>& frame = stack.back();
+        if (frame.second == graph.offsets[frame.first + 1]) {
+            stack.pop_back();       // Every neighbor is done; return to the caller frame
+            continue;
+        }
+        std::uint32_t adjacentVertex = graph.targets[frame.second++];
+        if (!visited[adjacentVertex]) {
+            visited[adjacentVertex] = true;
+            order.push_back(adjacentVertex);
+            stack.push_back(std::make_pair(adjacentVertex, graph.offsets[adjacentVertex]));
+        }
+    }
+    return order;
+}
+
+#endif // COMPRESSED_SPARSE_ROW_GRAPH_HPP
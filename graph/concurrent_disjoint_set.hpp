@@ -0,0 +1,168 @@
+/**
+ * @file concurrent_disjoint_set.hpp
+ * @brief A lock-free disjoint set (union-find) shared by threads, and a parallel connected components driver over an edge list
+ *        Unlike DisjointSet (disjoint_set.hpp), find and unite may be called from many threads at once without any lock;
+ *        both only use compare-and-swap (CAS) on the parent array.
+ *        It is shared by boruvka_mst.hpp and connected_components_benchmark.cpp (benchmark).
+ */
+
+#ifndef CONCURRENT_DISJOINT_SET_HPP
+#define CONCURRENT_DISJOINT_SET_HPP
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+// The rules deciding which of two roots is linked under the other
+//  - ByIndex: the root with the larger index goes under the smaller one.
+//  - Random: the root with the lower (pseudo-random, fixed per element) priority goes under the higher one.
+//            The trees stay shallow in expectation, even when the input links the elements in index order (e.g. a path 0-1-2-...).
+// Either way, the links always go in the same direction of a total order, so concurrent links can never create a cycle.
+enum class LinkingRule {
+    ByIndex,
+    Random
+};
+
+// Define the structure for a disjoint set shared by threads
+class ConcurrentDisjointSet {
+private:
+    std::vector<std::atomic<std::uint32_t>> parent;
+    std::atomic<std::size_t> numberOfSets;
+    LinkingRule linkingRule;
+
+    bool isLinkedUnder(std::uint32_t root1, std::uint32_t root2) const;
+
+public:
+    ConcurrentDisjointSet(unsigned int numberOfVertices, LinkingRule linkingRule = LinkingRule::ByIndex)
+        : parent(numberOfVertices), numberOfSets(numberOfVertices), linkingRule(linkingRule) {
+        for (unsigned int index = 0; index < numberOfVertices; index++) {
+            this->parent[index].store(index, std::memory_order_relaxed);
+        }
+    }
+
+    std::uint32_t findParentVertex(std::uint32_t targetVertex);
+    bool unite(std::uint32_t vertex1, std::uint32_t vertex2);
+    bool isSameSet(std::uint32_t vertex1, std::uint32_t vertex2);
+
+    std::size_t getNumberOfElements() const { return this->parent.size(); }
+    std::size_t getNumberOfSets() const { return this->numberOfSets.load(); }
+};
+
+// Helper method telling whether root1 is linked under root2 (rather than root2 under root1) by the linking rule
+inline bool ConcurrentDisjointSet::isLinkedUnder(std::uint32_t root1, std::uint32_t root2) const {
+    if (this->linkingRule == LinkingRule::Random) {
+        // A fixed pseudo-random priority per element (a multiplicative hash of the index), the index breaking ties
+        std::uint32_t priority1 = root1 * 2654435761u, priority2 = root2 * 2654435761u;
+        if (priority1 != priority2)
+            return priority1 < priority2;
+    }
+    return root1 > root2;
+}
+
+// Function to find the root of a vertex, halving the path on the way (each vertex skips to its grandparent)
+// A failed compare-and-swap only means another thread has shortened the path already, so it is ignored.
+inline std::uint32_t ConcurrentDisjointSet::findParentVertex(std::uint32_t targetVertex) {
+    while (true) {
+        std::uint32_t parentVertex = this->parent[targetVertex].load(std::memory_order_acquire);
+        if (parentVertex == targetVertex)
+            return targetVertex;
+        std::uint32_t grandparentVertex = this->parent[parentVertex].load(std::memory_order_acquire);
+        if (grandparentVertex != parentVertex) {
+            this->parent[targetVertex].compare_exchange_weak(parentVertex, grandparentVertex, std::memory_order_acq_rel);
+        }
+        targetVertex = grandparentVertex;
+    }
+}
+
+// Function to unite (union) two sets, returning false if they are already the same set
+// Exactly one of the threads uniting the same two sets at once gets true.
+inline bool ConcurrentDisjointSet::unite(std::uint32_t vertex1, std::uint32_t vertex2) {
+    while (true) {
+        std::uint32_t root1 = findParentVertex(vertex1);
+        std::uint32_t root2 = findParentVertex(vertex2);
+        if (root1 == root2)
+            return false;
+
+        // Link root1 under root2; retry if root1 stopped being a root meanwhile
+        if (!isLinkedUnder(root1, root2))
+            std::swap(root1, root2);
+        std::uint32_t expectedParent = root1;
+        if (this->parent[root1].compare_exchange_strong(expectedParent, root2, std::memory_order_acq_rel)) {
+            this->numberOfSets.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        vertex1 = root1;
+        vertex2 = root2;
+    }
+}
+
+// Function to tell whether two vertices are in the same set
+// Two different roots are only a valid answer if the first one is still a root after the second is found (no link in between).
+inline bool ConcurrentDisjointSet::isSameSet(std::uint32_t vertex1, std::uint32_t vertex2) {
+    while (true) {
+        std::uint32_t root1 = findParentVertex(vertex1);
+        std::uint32_t root2 = findParentVertex(vertex2);
+        if (root1 == root2)
+            return true;
+        if (this->parent[root1].load(std::memory_order_acquire) == root1)
+            return false;
+        vertex1 = root1;
+    }
+}
+
+// Function to find the connected components of a graph given as an edge list, with numThreads threads uniting the edges at once
+// Each thread takes a contiguous part of the edges, as if each were consuming its own stream of edges.
+// The component label of a vertex is the smallest vertex of its component, so the labels do not depend on the thread interleaving.
+inline std::vector<std::uint32_t> parallelConnectedComponents(unsigned int numberOfVertices, const std::vector<std::pair<std::uint32_t, std::uint32_t>>& edges,
+                                                              unsigned int numThreads, LinkingRule linkingRule = LinkingRule::ByIndex) {
+    if (numThreads == 0)
+        numThreads = 1;
+    ConcurrentDisjointSet disjointSet(numberOfVertices, linkingRule);
+    auto runThreads = [numThreads](std::size_t count, const std::function<void(std::size_t, std::size_t)>& body) {
+        std::vector<std::thread> threads;
+        for (unsigned int threadIndex = 1; threadIndex < numThreads; threadIndex++) {
+            threads.emplace_back(body, count * threadIndex / numThreads, count * (threadIndex + 1) / numThreads);
+        }
+        body(0, count / numThreads);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    };
+
+    runThreads(edges.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            disjointSet.unite(edges[index].first, edges[index].second);
+        }
+    });
+
+    // The smallest vertex of each component; every vertex offers itself to its root with an atomic minimum
+    std::vector<std::atomic<std::uint32_t>> smallestVertices(numberOfVertices);
+    runThreads(numberOfVertices, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t vertex = begin; vertex < end; vertex++) {
+            smallestVertices[vertex].store(UINT32_MAX, std::memory_order_relaxed);
+        }
+    });
+    std::vector<std::uint32_t> componentLabels(numberOfVertices);
+    runThreads(numberOfVertices, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t vertex = begin; vertex < end; vertex++) {
+            std::uint32_t root = disjointSet.findParentVertex(static_cast<std::uint32_t>(vertex));
+            componentLabels[vertex] = root;
+            std::uint32_t currentSmallest = smallestVertices[root].load(std::memory_order_relaxed);
+            while (vertex < currentSmallest &&
+                   !smallestVertices[root].compare_exchange_weak(currentSmallest, static_cast<std::uint32_t>(vertex), std::memory_order_relaxed)) {
+            }
+        }
+    });
+    runThreads(numberOfVertices, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t vertex = begin; vertex < end; vertex++) {
+            componentLabels[vertex] = smallestVertices[componentLabels[vertex]].load(std::memory_order_relaxed);
+        }
+    });
+    return componentLabels;
+}
+
+#endif // CONCURRENT_DISJOINT_SET_HPP
@@ -0,0 +1,192 @@
+/**
+ * @file connected_components_benchmark.cpp
+ * @brief A scalability benchmark of parallelConnectedComponents (concurrent_disjoint_set.hpp) over the number of threads
+ *        Each graph is also solved by the sequential DisjointSet (disjoint_set.hpp), which is the baseline of the speedup
+ *        and the reference the component labels are checked against.
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread connected_components_benchmark.cpp -o connected_components_benchmark
+ *                     ./connected_components_benchmark [--vertices V --edges E] [--threads T1,T2,...] [--format csv|json]
+ */
+
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <utility>
+#include <cstdint>
+#include <cstdlib>
+#include "disjoint_set.hpp"
+#include "concurrent_disjoint_set.hpp"
+
+// An edge list to find the connected components of
+struct EdgeListGraph {
+    std::string name;
+    unsigned int numberOfVertices;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+};
+
+// The measured result of a single run
+struct BenchmarkResult {
+    std::string graphName;
+    std::string implementationName;
+    unsigned int numThreads;
+    std::size_t numberOfComponents;
+    double runtimeMilliseconds;
+    double speedup;         // Against the sequential DisjointSet
+    bool valid;             // The labels are the same as the sequential DisjointSet's
+};
+
+// Generate a graph with uniformly random edges; the seed is fixed so that the graphs are the same across runs (and commits)
+EdgeListGraph generateRandomGraph(unsigned int numberOfVertices, std::size_t numberOfEdges) {
+    std::mt19937_64 randomEngine(20240701);
+    std::uniform_int_distribution<std::uint32_t> vertexDistribution(0, numberOfVertices - 1);
+    EdgeListGraph graph;
+    graph.name = "random-v" + std::to_string(numberOfVertices) + "-e" + std::to_string(numberOfEdges);
+    graph.numberOfVertices = numberOfVertices;
+    graph.edges.reserve(numberOfEdges);
+    for (std::size_t index = 0; index < numberOfEdges; index++) {
+        graph.edges.emplace_back(vertexDistribution(randomEngine), vertexDistribution(randomEngine));
+    }
+    return graph;
+}
+
+// Generate long paths (0-1-2-..., in index order) with every tenth edge missing, which builds deep trees with a naive linking
+EdgeListGraph generatePathsGraph(unsigned int numberOfVertices) {
+    EdgeListGraph graph;
+    graph.name = "paths-v" + std::to_string(numberOfVertices);
+    graph.numberOfVertices = numberOfVertices;
+    for (std::uint32_t vertex = 1; vertex < numberOfVertices; vertex++) {
+        if (vertex % 10 != 0) {
+            graph.edges.emplace_back(vertex, vertex - 1);
+        }
+    }
+    return graph;
+}
+
+// Label every vertex with the smallest vertex of its component, with the sequential DisjointSet
+std::vector<std::uint32_t> sequentialConnectedComponents(const EdgeListGraph& graph) {
+    DisjointSet disjointSet(graph.numberOfVertices);
+    for (const auto& edge : graph.edges) {
+        disjointSet.unite(static_cast<int>(edge.first), static_cast<int>(edge.second));
+    }
+    std::vector<std::uint32_t> smallestVertices(graph.numberOfVertices, UINT32_MAX);
+    std::vector<std::uint32_t> componentLabels(graph.numberOfVertices);
+    for (std::uint32_t vertex = 0; vertex < graph.numberOfVertices; vertex++) {
+        std::uint32_t root = static_cast<std::uint32_t>(disjointSet.findParentVertex(static_cast<int>(vertex)));
+        if (smallestVertices[root] == UINT32_MAX) {
+            smallestVertices[root] = vertex;
+        }
+        componentLabels[vertex] = smallestVertices[root];
+    }
+    return componentLabels;
+}
+
+// Count the components of a labeling (the vertices labeled with themselves)
+std::size_t countComponents(const std::vector<std::uint32_t>& componentLabels) {
+    std::size_t numberOfComponents = 0;
+    for (std::size_t vertex = 0; vertex < componentLabels.size(); vertex++) {
+        numberOfComponents += (componentLabels[vertex] == vertex) ? 1 : 0;
+    }
+    return numberOfComponents;
+}
+
+// Run the sequential baseline, then the concurrent version with each linking rule and thread count
+std::vector<BenchmarkResult> benchmarkGraph(const EdgeListGraph& graph, const std::vector<unsigned int>& threadCounts) {
+    std::vector<BenchmarkResult> results;
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<std::uint32_t> referenceLabels = sequentialConnectedComponents(graph);
+    const double sequentialMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    results.push_back(BenchmarkResult{graph.name, "sequential", 1, countComponents(referenceLabels), sequentialMilliseconds, 1.0, true});
+
+    for (LinkingRule linkingRule : {LinkingRule::ByIndex, LinkingRule::Random}) {
+        for (unsigned int numThreads : threadCounts) {
+            startTime = std::chrono::steady_clock::now();
+            std::vector<std::uint32_t> componentLabels = parallelConnectedComponents(graph.numberOfVertices, graph.edges, numThreads, linkingRule);
+            const double runtimeMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            results.push_back(BenchmarkResult{graph.name, linkingRule == LinkingRule::ByIndex ? "concurrent-by-index" : "concurrent-random",
+                                              numThreads, countComponents(componentLabels), runtimeMilliseconds,
+                                              sequentialMilliseconds / runtimeMilliseconds, componentLabels == referenceLabels});
+        }
+    }
+    return results;
+}
+
+int main(int argc, char* argv[]) {
+    std::string outputFormat = "csv";
+    unsigned int numberOfVertices = 0;
+    std::size_t numberOfEdges = 0;
+    std::vector<unsigned int> threadCounts = {1, 2, 4, 8};
+    for (int index = 1; index < argc; index++) {
+        std::string argument = argv[index];
+        if (argument == "--vertices" && index + 1 < argc) {
+            numberOfVertices = static_cast<unsigned int>(std::strtoul(argv[++index], nullptr, 10));
+        } else if (argument == "--edges" && index + 1 < argc) {
+            numberOfEdges = static_cast<std::size_t>(std::strtoull(argv[++index], nullptr, 10));
+        } else if (argument == "--threads" && index + 1 < argc) {
+            threadCounts.clear();
+            std::stringstream threadList(argv[++index]);
+            std::string threadCount;
+            while (std::getline(threadList, threadCount, ',')) {
+                threadCounts.push_back(static_cast<unsigned int>(std::strtoul(threadCount.c_str(), nullptr, 10)));
+            }
+        } else if (argument == "--format" && index + 1 < argc) {
+            outputFormat = argv[++index];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--vertices V --edges E] [--threads T1,T2,...] [--format csv|json]" << std::endl;
+            return 1;
+        }
+    }
+    if ((outputFormat != "csv" && outputFormat != "json") || (numberOfVertices == 0) != (numberOfEdges == 0) || threadCounts.empty()) {
+        std::cerr << "The format must be csv or json, --vertices and --edges must be given together, and a thread count is required" << std::endl;
+        return 1;
+    }
+
+    std::vector<EdgeListGraph> graphs;
+    if (numberOfVertices != 0) {
+        graphs.push_back(generateRandomGraph(numberOfVertices, numberOfEdges));
+    } else {
+        graphs.push_back(generateRandomGraph(1000000, 800000));        // Many small components
+        graphs.push_back(generateRandomGraph(1000000, 10000000));      // One giant component
+        graphs.push_back(generatePathsGraph(10000000));
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const EdgeListGraph& graph : graphs) {
+        std::vector<BenchmarkResult> graphResults = benchmarkGraph(graph, threadCounts);
+        results.insert(results.end(), graphResults.begin(), graphResults.end());
+    }
+
+    if (outputFormat == "csv") {
+        std::cout << "graph,implementation,threads,components,runtime_ms,speedup,valid" << std::endl;
+        for (const BenchmarkResult& result : results) {
+            std::cout << result.graphName << ',' << result.implementationName << ',' << result.numThreads << ',' << result.numberOfComponents << ','
+                      << result.runtimeMilliseconds << ',' << result.speedup << ',' << (result.valid ? "true" : "false") << std::endl;
+        }
+    } else {
+        std::cout << "[" << std::endl;
+        for (std::size_t index = 0; index < results.size(); index++) {
+            const BenchmarkResult& result = results[index];
+            std::cout << "  {\"graph\": \"" << result.graphName << "\", \"implementation\": \"" << result.implementationName << "\""
+                      << ", \"threads\": " << result.numThreads << ", \"components\": " << result.numberOfComponents
+                      << ", \"runtime_ms\": " << result.runtimeMilliseconds << ", \"speedup\": " << result.speedup
+                      << ", \"valid\": " << (result.valid ? "true" : "false") << "}" << (index + 1 < results.size() ? "," : "") << std::endl;
+        }
+        std::cout << "]" << std::endl;
+    }
+
+    return 0;
+}
+
+// $ ./connected_components_benchmark
+// graph,implementation,threads,components,runtime_ms,speedup,valid
+// random-v1000000-e800000,sequential,1,255335,58.5128,1,true
+// random-v1000000-e800000,concurrent-by-index,1,255335,120.259,0.486556,true
+// random-v1000000-e800000,concurrent-by-index,2,255335,99.9689,0.58531,true
+// ...
+// random-v1000000-e10000000,concurrent-random,8,1,206.866,0.808856,true
+// paths-v10000000,sequential,1,1000000,147.665,1,true
+// ...
+// (Measured on a single core, so the threads only interleave; the runtimes vary by machine, the components are deterministic)
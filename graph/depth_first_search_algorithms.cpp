@@ -0,0 +1,110 @@
+/**
+ * @file depth_first_search_algorithms.cpp
+ * @brief Examples of the DFS-based algorithms of depth_first_search_algorithms.hpp; strongly connected components (sequential and parallel),
+ *        topological sort, bridges and articulation points, and a DFS over a path too deep for a recursive version
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread depth_first_search_algorithms.cpp -o depth_first_search_algorithms
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <utility>
+#include <stdexcept>
+#include <cstdint>
+#include "compressed_sparse_row_graph.hpp"
+#include "depth_first_search_algorithms.hpp"
+
+// A helper method to print the vertices of each strongly connected component, a component per line
+void displayComponents(const StronglyConnectedComponents& components) {
+    std::map<std::uint32_t, std::vector<std::uint32_t>> verticesByComponent;
+    for (std::uint32_t vertex = 0; vertex < components.componentOf.size(); vertex++) {
+        verticesByComponent[components.componentOf[vertex]].push_back(vertex);
+    }
+    for (const auto& component : verticesByComponent) {
+        std::cout << "Component " << component.first << ":";
+        for (std::uint32_t vertex : component.second) {
+            std::cout << " " << vertex;
+        }
+        std::cout << std::endl;
+    }
+}
+
+// A helper method to turn undirected edges into a CSR graph (each edge in both directions)
+CsrGraph<std::uint32_t> buildUndirectedCsrGraph(std::uint32_t numberOfVertices, const std::vector<std::pair<std::uint32_t, std::uint32_t>>& edges) {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> directedEdges;
+    for (const auto& edge : edges) {
+        directedEdges.push_back(edge);
+        directedEdges.push_back(std::make_pair(edge.second, edge.first));
+    }
+    return buildCsrGraph(numberOfVertices, directedEdges);
+}
+
+int main(void) {
+    // A directed graph with 3 cycles (0 -> 1 -> 2 -> 0, 3 -> 4 -> 3, 5 -> 6 -> 7 -> 5) linked one way, and a vertex 8 on its own
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 3}, {4, 5}, {5, 6}, {6, 7}, {7, 5}, {8, 7}};
+    CsrGraph<std::uint32_t> graph = buildCsrGraph(9, edges);
+
+    std::cout << "Strongly connected components (Tarjan):" << std::endl;
+    StronglyConnectedComponents components = findStronglyConnectedComponents(graph);
+    displayComponents(components);
+
+    StronglyConnectedComponents parallelComponents = parallelStronglyConnectedComponents(graph, transposeCsrGraph(graph), 4);
+    // The numbering differs, so every component must map to exactly one parallel component (and the counts must match)
+    bool isSamePartition = parallelComponents.numberOfComponents == components.numberOfComponents;
+    std::map<std::uint32_t, std::uint32_t> parallelComponentOf;
+    for (std::uint32_t vertex = 0; vertex < graph.getNumberOfVertices(); vertex++) {
+        auto inserted = parallelComponentOf.insert(std::make_pair(components.componentOf[vertex], parallelComponents.componentOf[vertex]));
+        isSamePartition = isSamePartition && inserted.first->second == parallelComponents.componentOf[vertex];
+    }
+    std::cout << "Parallel (forward-backward) finds the same components: " << (isSamePartition ? "Yes" : "No") << std::endl;
+
+    // Topological sort of course prerequisites (an edge from a course to a course requiring it)
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> prerequisites = {{0, 2}, {1, 2}, {2, 3}, {1, 4}, {4, 3}, {3, 5}};
+    std::cout << "Topological order:";
+    for (std::uint32_t course : topologicalSort(buildCsrGraph(6, prerequisites))) {
+        std::cout << " " << course;
+    }
+    std::cout << std::endl;
+    try {
+        topologicalSort(graph);
+    } catch (const std::invalid_argument& exception) {
+        std::cout << "Topological sort of the cyclic graph: " << exception.what() << std::endl;
+    }
+
+    // Bridges and articulation points of an undirected graph; two triangles (0, 1, 2) and (3, 4, 5) joined by the edge 2 - 3, and a leaf 6 on 5
+    CsrGraph<std::uint32_t> undirectedGraph = buildUndirectedCsrGraph(7, {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 3}, {5, 6}});
+    BiconnectivityResult biconnectivity = findBridgesAndArticulationPoints(undirectedGraph);
+    std::cout << "Bridges:";
+    for (const auto& bridge : biconnectivity.bridges) {
+        std::cout << " (" << bridge.first << ", " << bridge.second << ")";
+    }
+    std::cout << std::endl << "Articulation points:";
+    for (std::uint32_t vertex : biconnectivity.articulationPoints) {
+        std::cout << " " << vertex;
+    }
+    std::cout << std::endl;
+
+    // A path of 10 million vertices closed into a cycle; a recursive DFS would need 10 million nested calls
+    const std::uint32_t numberOfPathVertices = 10000000;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pathEdges;
+    for (std::uint32_t vertex = 0; vertex < numberOfPathVertices; vertex++) {
+        pathEdges.push_back(std::make_pair(vertex, (vertex + 1) % numberOfPathVertices));
+    }
+    std::cout << "Components of the 10M cycle: " << findStronglyConnectedComponents(buildCsrGraph(numberOfPathVertices, pathEdges)).numberOfComponents << std::endl;
+
+    return 0;
+}
+
+// Strongly connected components (Tarjan):
+// Component 0: 5 6 7
+// Component 1: 3 4
+// Component 2: 0 1 2
+// Component 3: 8
+// Parallel (forward-backward) finds the same components: Yes
+// Topological order: 1 4 0 2 3 5
+// Topological sort of the cyclic graph: The graph has a cycle
+// Bridges: (2, 3) (5, 6)
+// Articulation points: 2 3 5
+// Components of the 10M cycle: 1
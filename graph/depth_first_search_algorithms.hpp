@@ -0,0 +1,511 @@
+/**
+ * @file depth_first_search_algorithms.hpp
+ * @brief Algorithms built on Depth First Search (DFS) over a CSR graph (compressed_sparse_row_graph.hpp) in C++ language
+ *        Tarjan's strongly connected components (SCC), topological sort, bridges and articulation points, and a parallel SCC for large directed graphs.
+ *        Every DFS is iterative with an explicit stack of (vertex, next edge index) frames, so a deep graph (e.g. a path of millions of vertices)
+ *        cannot overflow the call stack, unlike the recursive versions (depth_first_search_via_adjacent_list.c).
+ *        It is shared by depth_first_search_algorithms.cpp (example) and the other programs working on directed graphs.
+ */
+
+#ifndef DEPTH_FIRST_SEARCH_ALGORITHMS_HPP
+#define DEPTH_FIRST_SEARCH_ALGORITHMS_HPP
+
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include "compressed_sparse_row_graph.hpp"
+
+// The strongly connected components of a directed graph; componentOf[v] is the component of v (0, 1, ..., numberOfComponents - 1)
+struct StronglyConnectedComponents {
+    std::vector<std::uint32_t> componentOf;
+    std::uint32_t numberOfComponents = 0;
+};
+
+// The bridges (edges whose removal disconnects their endpoints) and the articulation points (vertices whose removal disconnects the graph)
+// of an undirected graph. A bridge is (smaller endpoint, larger endpoint); both lists are sorted.
+struct BiconnectivityResult {
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> bridges;
+    std::vector<std::uint32_t> articulationPoints;
+};
+
+// Function to find the strongly connected components with Tarjan's Algorithm in O(n + m)
+// The components are numbered in the order they are completed, which is a reverse topological order of the condensation
+// (if an edge goes from component a to component b, then a > b).
+template <typename EdgeWeightType>
+StronglyConnectedComponents findStronglyConnectedComponents(const CsrGraph<EdgeWeightType>& graph) {
+    const std::uint32_t UNVISITED = UINT32_MAX;
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+    std::vector<std::uint32_t> discoveryIndex(numberOfVertices, UNVISITED), lowLink(numberOfVertices);
+    std::vector<bool> isOnStack(numberOfVertices, false);
+    std::vector<std::uint32_t> componentStack;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> callStack;
+    std::uint32_t nextDiscoveryIndex = 0;
+
+    StronglyConnectedComponents components;
+    components.componentOf.assign(numberOfVertices, UNVISITED);
+    for (std::uint32_t rootVertex = 0; rootVertex < numberOfVertices; rootVertex++) {
+        if (discoveryIndex[rootVertex] != UNVISITED)
+            continue;
+        discoveryIndex[rootVertex] = lowLink[rootVertex] = nextDiscoveryIndex++;
+        componentStack.push_back(rootVertex);
+        isOnStack[rootVertex] = true;
+        callStack.push_back(std::make_pair(rootVertex, graph.offsets[rootVertex]));
+
+        while (!callStack.empty()) {
+            const std::uint32_t vertex = callStack.back().first;
+            if (callStack.back().second < graph.offsets[vertex + 1]) {
+                const std::uint32_t adjacentVertex = graph.targets[callStack.back().second++];
+                if (discoveryIndex[adjacentVertex] == UNVISITED) {
+                    // Tree edge; descend into the adjacent vertex
+                    discoveryIndex[adjacentVertex] = lowLink[adjacentVertex] = nextDiscoveryIndex++;
+                    componentStack.push_back(adjacentVertex);
+                    isOnStack[adjacentVertex] = true;
+                    callStack.push_back(std::make_pair(adjacentVertex, graph.offsets[adjacentVertex]));
+                } else if (isOnStack[adjacentVertex]) {
+                    lowLink[vertex] = std::min(lowLink[vertex], discoveryIndex[adjacentVertex]);
+                }
+                continue;
+            }
+
+            // Every edge of the vertex is done; it is the root of a component if nothing below it reaches higher
+            callStack.pop_back();
+            if (lowLink[vertex] == discoveryIndex[vertex]) {
+                std::uint32_t memberVertex;
+                do {
+                    memberVertex = componentStack.back();
+                    componentStack.pop_back();
+                    isOnStack[memberVertex] = false;
+                    components.componentOf[memberVertex] = components.numberOfComponents;
+                } while (memberVertex != vertex);
+                components.numberOfComponents++;
+            }
+            if (!callStack.empty()) {
+                const std::uint32_t parentVertex = callStack.back().first;
+                lowLink[parentVertex] = std::min(lowLink[parentVertex], lowLink[vertex]);
+            }
+        }
+    }
+    return components;
+}
+
+// Function to sort the vertices of a directed acyclic graph topologically (every edge goes from an earlier vertex to a later one) in O(n + m)
+// The reverse of the DFS finishing order; an edge to a vertex still on the DFS path is a cycle, which throws invalid_argument.
+template <typename EdgeWeightType>
+std::vector<std::uint32_t> topologicalSort(const CsrGraph<EdgeWeightType>& graph) {
+    enum VisitState : std::uint8_t { UNVISITED, ON_PATH, FINISHED };
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+    std::vector<std::uint8_t> visitStates(numberOfVertices, UNVISITED);
+    std::vector<std::uint32_t> finishingOrder;
+    finishingOrder.reserve(numberOfVertices);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> callStack;
+
+    for (std::uint32_t rootVertex = 0; rootVertex < numberOfVertices; rootVertex++) {
+        if (visitStates[rootVertex] != UNVISITED)
+            continue;
+        visitStates[rootVertex] = ON_PATH;
+        callStack.push_back(std::make_pair(rootVertex, graph.offsets[rootVertex]));
+        while (!callStack.empty()) {
+            const std::uint32_t vertex = callStack.back().first;
+            if (callStack.back().second < graph.offsets[vertex + 1]) {
+                const std::uint32_t adjacentVertex = graph.targets[callStack.back().second++];
+                if (visitStates[adjacentVertex] == ON_PATH) {
+                    throw std::invalid_argument("The graph has a cycle");
+                }
+                if (visitStates[adjacentVertex] == UNVISITED) {
+                    visitStates[adjacentVertex] = ON_PATH;
+                    callStack.push_back(std::make_pair(adjacentVertex, graph.offsets[adjacentVertex]));
+                }
+                continue;
+            }
+            callStack.pop_back();
+            visitStates[vertex] = FINISHED;
+            finishingOrder.push_back(vertex);
+        }
+    }
+    std::reverse(finishingOrder.begin(), finishingOrder.end());
+    return finishingOrder;
+}
+
+// Function to find the bridges and the articulation points of an undirected graph (each edge stored in both directions) in O(n + m)
+// low[v] is the earliest discovery index reachable from the DFS subtree of v with at most one back edge; the tree edge (parent, v) is a bridge
+// if low[v] > discovery[parent], and a non-root parent is an articulation point if low[v] >= discovery[parent] for some child v.
+// Only one edge back to the parent is skipped (the tree edge itself), so parallel edges are not mistaken for bridges.
+template <typename EdgeWeightType>
+BiconnectivityResult findBridgesAndArticulationPoints(const CsrGraph<EdgeWeightType>& graph) {
+    const std::uint32_t UNVISITED = UINT32_MAX;
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+
+    // A frame of the DFS; the vertex, its parent (itself for a root), the next edge, and whether the tree edge to the parent has been skipped
+    struct Frame {
+        std::uint32_t vertex;
+        std::uint32_t parentVertex;
+        std::uint32_t nextEdgeIndex;
+        bool hasSkippedParentEdge;
+    };
+
+    std::vector<std::uint32_t> discoveryIndex(numberOfVertices, UNVISITED), lowLink(numberOfVertices);
+    std::vector<bool> isArticulationPoint(numberOfVertices, false);
+    std::vector<Frame> callStack;
+    std::uint32_t nextDiscoveryIndex = 0;
+
+    BiconnectivityResult result;
+    for (std::uint32_t rootVertex = 0; rootVertex < numberOfVertices; rootVertex++) {
+        if (discoveryIndex[rootVertex] != UNVISITED)
+            continue;
+        std::uint32_t rootChildren = 0;
+        discoveryIndex[rootVertex] = lowLink[rootVertex] = nextDiscoveryIndex++;
+        callStack.push_back(Frame{rootVertex, rootVertex, graph.offsets[rootVertex], true});
+
+        while (!callStack.empty()) {
+            Frame& frame = callStack.back();
+            const std::uint32_t vertex = frame.vertex;
+            if (frame.nextEdgeIndex < graph.offsets[vertex + 1]) {
+                const std::uint32_t adjacentVertex = graph.targets[frame.nextEdgeIndex++];
+                if (adjacentVertex == frame.parentVertex && !frame.hasSkippedParentEdge) {
+                    frame.hasSkippedParentEdge = true;
+                } else if (discoveryIndex[adjacentVertex] == UNVISITED) {
+                    discoveryIndex[adjacentVertex] = lowLink[adjacentVertex] = nextDiscoveryIndex++;
+                    callStack.push_back(Frame{adjacentVertex, vertex, graph.offsets[adjacentVertex], false});
+                } else {
+                    lowLink[vertex] = std::min(lowLink[vertex], discoveryIndex[adjacentVertex]);
+                }
+                continue;
+            }
+
+            const std::uint32_t parentVertex = frame.parentVertex;
+            callStack.pop_back();
+            if (parentVertex == vertex)
+                continue;       // The root is done
+            lowLink[parentVertex] = std::min(lowLink[parentVertex], lowLink[vertex]);
+            if (lowLink[vertex] > discoveryIndex[parentVertex]) {
+                result.bridges.push_back(std::make_pair(std::min(parentVertex, vertex), std::max(parentVertex, vertex)));
+            }
+            if (parentVertex == rootVertex) {
+                rootChildren++;
+            } else if (lowLink[vertex] >= discoveryIndex[parentVertex]) {
+                isArticulationPoint[parentVertex] = true;
+            }
+        }
+        if (rootChildren >= 2) {
+            isArticulationPoint[rootVertex] = true;
+        }
+    }
+
+    for (std::uint32_t vertex = 0; vertex < numberOfVertices; vertex++) {
+        if (isArticulationPoint[vertex]) {
+            result.articulationPoints.push_back(vertex);
+        }
+    }
+    std::sort(result.bridges.begin(), result.bridges.end());
+    return result;
+}
+
+// Function to find the bridges of an undirected graph (see findBridgesAndArticulationPoints)
+template <typename EdgeWeightType>
+std::vector<std::pair<std::uint32_t, std::uint32_t>> findBridges(const CsrGraph<EdgeWeightType>& graph) {
+    return findBridgesAndArticulationPoints(graph).bridges;
+}
+
+// Function to find the articulation points of an undirected graph (see findBridgesAndArticulationPoints)
+template <typename EdgeWeightType>
+std::vector<std::uint32_t> findArticulationPoints(const CsrGraph<EdgeWeightType>& graph) {
+    return findBridgesAndArticulationPoints(graph).articulationPoints;
+}
+
+// Function to find the strongly connected components of a large directed graph with numThreads threads (forward-backward with trimming)
+//  1. Trimming: a vertex without incoming or outgoing edges (among the remaining vertices) is a component by itself; it is removed,
+//     which may expose more such vertices. Each thread peels the vertices it claims from a worklist of its own, all in a single parallel region,
+//     so a long chain costs one pass rather than a round per peeled layer. On real graphs, most of the components are trimmed this way.
+//  2. Forward-backward: for a set of vertices with a pivot, the vertices both reachable from the pivot (forward) and reaching it (backward)
+//     are the component of the pivot. Every other component lies entirely in one of the three rest sets (forward only, backward only, neither),
+//     so those become independent tasks, run by the threads from a shared queue. The pivot is a pseudo-random vertex of the set, so a chain
+//     of cycles is split around the middle on average instead of losing one component per task (quadratic). A task trims its set first,
+//     as removing a component may expose trivial ones, and a set smaller than SEQUENTIAL_TASK_SIZE is finished by Tarjan's Algorithm.
+// The transposedGraph is transposeCsrGraph(graph). The component numbers depend on the thread interleaving (the components do not).
+template <typename EdgeWeightType>
+StronglyConnectedComponents parallelStronglyConnectedComponents(const CsrGraph<EdgeWeightType>& graph, const CsrGraph<EdgeWeightType>& transposedGraph,
+                                                                 unsigned int numThreads = std::thread::hardware_concurrency()) {
+    const std::size_t PARALLEL_GRAIN_SIZE = 1 << 14;        // The smallest number of vertices worth a thread of its own
+    const std::size_t SEQUENTIAL_TASK_SIZE = 1 << 12;       // The sets below this size run Tarjan's Algorithm instead of forward-backward
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+    if (transposedGraph.getNumberOfVertices() != numberOfVertices || transposedGraph.getNumberOfEdges() != graph.getNumberOfEdges()) {
+        throw std::invalid_argument("The transposed graph does not match the graph");
+    }
+    if (numThreads == 0)
+        numThreads = 1;
+    // Split [0, count) into one contiguous chunk per thread (of at least grainSize items) and run body(threadIndex, begin, end) on each
+    auto runThreads = [numThreads](std::size_t count, std::size_t grainSize, const std::function<void(unsigned int, std::size_t, std::size_t)>& body) {
+        unsigned int numChunks = static_cast<unsigned int>(std::min<std::size_t>(numThreads, std::max<std::size_t>(count / grainSize, 1)));
+        std::vector<std::thread> threads;
+        for (unsigned int chunkIndex = 1; chunkIndex < numChunks; chunkIndex++) {
+            threads.emplace_back(body, chunkIndex, count * chunkIndex / numChunks, count * (chunkIndex + 1) / numChunks);
+        }
+        body(0, 0, count / numChunks);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    };
+
+    // The set (task) each vertex belongs to; DONE once its component is known. A task only rewrites the sets of its own vertices,
+    // but reads the sets of the neighbors (of any task), so the sets are atomic. The Tarjan arrays are only touched by the task owning the vertex.
+    const std::uint32_t DONE = UINT32_MAX, UNVISITED = UINT32_MAX;
+    std::vector<std::atomic<std::uint32_t>> setOf(numberOfVertices);
+    std::vector<std::atomic<std::uint32_t>> remainingInDegrees(numberOfVertices), remainingOutDegrees(numberOfVertices);
+    std::vector<std::uint32_t> discoveryIndex(numberOfVertices, UNVISITED), lowLink(numberOfVertices);
+    std::atomic<std::uint32_t> nextComponent(0), nextSet(1);
+    StronglyConnectedComponents components;
+    components.componentOf.assign(numberOfVertices, DONE);
+
+    // 1. Trimming; a vertex is claimed (DONE by CAS) by the thread that finds one of its degrees zero, then peeled from that thread's worklist
+    runThreads(numberOfVertices, PARALLEL_GRAIN_SIZE, [&](unsigned int, std::size_t begin, std::size_t end) {
+        for (std::size_t vertex = begin; vertex < end; vertex++) {
+            remainingInDegrees[vertex].store(transposedGraph.getDegree(static_cast<std::uint32_t>(vertex)), std::memory_order_relaxed);
+            remainingOutDegrees[vertex].store(graph.getDegree(static_cast<std::uint32_t>(vertex)), std::memory_order_relaxed);
+            setOf[vertex].store(0, std::memory_order_relaxed);
+        }
+    });
+    runThreads(numberOfVertices, PARALLEL_GRAIN_SIZE, [&](unsigned int, std::size_t begin, std::size_t end) {
+        std::vector<std::uint32_t> worklist;
+        auto claim = [&](std::uint32_t vertex) {
+            std::uint32_t expectedSet = 0;
+            if (setOf[vertex].compare_exchange_strong(expectedSet, DONE, std::memory_order_relaxed)) {
+                worklist.push_back(vertex);
+            }
+        };
+        for (std::size_t seedVertex = begin; seedVertex < end; seedVertex++) {
+            if (remainingInDegrees[seedVertex].load(std::memory_order_relaxed) != 0 && remainingOutDegrees[seedVertex].load(std::memory_order_relaxed) != 0)
+                continue;
+            claim(static_cast<std::uint32_t>(seedVertex));
+            while (!worklist.empty()) {
+                const std::uint32_t vertex = worklist.back();
+                worklist.pop_back();
+                components.componentOf[vertex] = nextComponent.fetch_add(1, std::memory_order_relaxed);
+                for (std::uint32_t edgeIndex = graph.offsets[vertex]; edgeIndex < graph.offsets[vertex + 1]; edgeIndex++) {
+                    if (remainingInDegrees[graph.targets[edgeIndex]].fetch_sub(1, std::memory_order_relaxed) == 1)
+                        claim(graph.targets[edgeIndex]);
+                }
+                for (std::uint32_t edgeIndex = transposedGraph.offsets[vertex]; edgeIndex < transposedGraph.offsets[vertex + 1]; edgeIndex++) {
+                    if (remainingOutDegrees[transposedGraph.targets[edgeIndex]].fetch_sub(1, std::memory_order_relaxed) == 1)
+                        claim(transposedGraph.targets[edgeIndex]);
+                }
+            }
+        }
+    });
+
+    // 2. Forward-backward over the remaining vertices (set 0), as tasks of (set, vertices) in a shared queue
+    std::deque<std::pair<std::uint32_t, std::vector<std::uint32_t>>> taskQueue;
+    std::mutex taskQueueMutex;
+    std::condition_variable taskQueueChanged;
+    std::size_t runningTasks = 0;
+    {
+        std::vector<std::uint32_t> remainingVertices;
+        for (std::uint32_t vertex = 0; vertex < numberOfVertices; vertex++) {
+            if (setOf[vertex].load(std::memory_order_relaxed) == 0) {
+                remainingVertices.push_back(vertex);
+            }
+        }
+        if (!remainingVertices.empty()) {
+            taskQueue.push_back(std::make_pair(0u, std::move(remainingVertices)));
+        }
+    }
+
+    // Trim a set sequentially; the degrees count only the edges within the set, then the zero-degree vertices are peeled
+    auto trimSet = [&](std::uint32_t set, std::vector<std::uint32_t>& vertices) {
+        auto isInSet = [&](std::uint32_t vertex) { return setOf[vertex].load(std::memory_order_relaxed) == set; };
+        std::vector<std::uint32_t> worklist;
+        for (std::uint32_t vertex : vertices) {
+            std::uint32_t inDegree = 0, outDegree = 0;
+            for (std::uint32_t edgeIndex = graph.offsets[vertex]; edgeIndex < graph.offsets[vertex + 1]; edgeIndex++) {
+                outDegree += isInSet(graph.targets[edgeIndex]) ? 1 : 0;
+            }
+            for (std::uint32_t edgeIndex = transposedGraph.offsets[vertex]; edgeIndex < transposedGraph.offsets[vertex + 1]; edgeIndex++) {
+                inDegree += isInSet(transposedGraph.targets[edgeIndex]) ? 1 : 0;
+            }
+            remainingInDegrees[vertex].store(inDegree, std::memory_order_relaxed);
+            remainingOutDegrees[vertex].store(outDegree, std::memory_order_relaxed);
+            if (inDegree == 0 || outDegree == 0) {
+                worklist.push_back(vertex);
+            }
+        }
+        for (std::uint32_t vertex : worklist) {
+            setOf[vertex].store(DONE, std::memory_order_relaxed);
+        }
+        while (!worklist.empty()) {
+            const std::uint32_t vertex = worklist.back();
+            worklist.pop_back();
+            components.componentOf[vertex] = nextComponent.fetch_add(1, std::memory_order_relaxed);
+            for (std::uint32_t edgeIndex = graph.offsets[vertex]; edgeIndex < graph.offsets[vertex + 1]; edgeIndex++) {
+                const std::uint32_t adjacentVertex = graph.targets[edgeIndex];
+                if (isInSet(adjacentVertex) && remainingInDegrees[adjacentVertex].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                    setOf[adjacentVertex].store(DONE, std::memory_order_relaxed);
+                    worklist.push_back(adjacentVertex);
+                }
+            }
+            for (std::uint32_t edgeIndex = transposedGraph.offsets[vertex]; edgeIndex < transposedGraph.offsets[vertex + 1]; edgeIndex++) {
+                const std::uint32_t adjacentVertex = transposedGraph.targets[edgeIndex];
+                if (isInSet(adjacentVertex) && remainingOutDegrees[adjacentVertex].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                    setOf[adjacentVertex].store(DONE, std::memory_order_relaxed);
+                    worklist.push_back(adjacentVertex);
+                }
+            }
+        }
+        vertices.erase(std::remove_if(vertices.begin(), vertices.end(), [&](std::uint32_t vertex) { return !isInSet(vertex); }), vertices.end());
+    };
+
+    // Finish a small set with Tarjan's Algorithm restricted to its vertices (as findStronglyConnectedComponents)
+    // A visited vertex still in the set is on the component stack, since a completed component leaves the set (DONE).
+    auto runTarjan = [&](std::uint32_t set, const std::vector<std::uint32_t>& vertices) {
+        std::vector<std::uint32_t> componentStack;
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> callStack;
+        std::uint32_t nextDiscoveryIndex = 0;
+        for (std::uint32_t rootVertex : vertices) {
+            if (discoveryIndex[rootVertex] != UNVISITED)
+                continue;
+            discoveryIndex[rootVertex] = lowLink[rootVertex] = nextDiscoveryIndex++;
+            componentStack.push_back(rootVertex);
+            callStack.push_back(std::make_pair(rootVertex, graph.offsets[rootVertex]));
+
+            while (!callStack.empty()) {
+                const std::uint32_t vertex = callStack.back().first;
+                if (callStack.back().second < graph.offsets[vertex + 1]) {
+                    const std::uint32_t adjacentVertex = graph.targets[callStack.back().second++];
+                    if (setOf[adjacentVertex].load(std::memory_order_relaxed) != set)
+                        continue;
+                    if (discoveryIndex[adjacentVertex] == UNVISITED) {
+                        discoveryIndex[adjacentVertex] = lowLink[adjacentVertex] = nextDiscoveryIndex++;
+                        componentStack.push_back(adjacentVertex);
+                        callStack.push_back(std::make_pair(adjacentVertex, graph.offsets[adjacentVertex]));
+                    } else {
+                        lowLink[vertex] = std::min(lowLink[vertex], discoveryIndex[adjacentVertex]);
+                    }
+                    continue;
+                }
+
+                callStack.pop_back();
+                if (lowLink[vertex] == discoveryIndex[vertex]) {
+                    const std::uint32_t component = nextComponent.fetch_add(1, std::memory_order_relaxed);
+                    std::uint32_t memberVertex;
+                    do {
+                        memberVertex = componentStack.back();
+                        componentStack.pop_back();
+                        setOf[memberVertex].store(DONE, std::memory_order_relaxed);
+                        components.componentOf[memberVertex] = component;
+                    } while (memberVertex != vertex);
+                }
+                if (!callStack.empty()) {
+                    const std::uint32_t parentVertex = callStack.back().first;
+                    lowLink[parentVertex] = std::min(lowLink[parentVertex], lowLink[vertex]);
+                }
+            }
+        }
+    };
+
+    // Run one task; after trimming, the vertices reached forward from the pivot move to a new set, then the backward search
+    // splits them into the component and the rest
+    auto runTask = [&](std::uint32_t set, std::vector<std::uint32_t>& vertices) {
+        trimSet(set, vertices);
+        if (vertices.empty())
+            return;
+        if (vertices.size() < SEQUENTIAL_TASK_SIZE) {
+            runTarjan(set, vertices);
+            return;
+        }
+
+        // A pseudo-random pivot from the set number (a set number is never reused by a later task of the same size)
+        std::uint64_t pivotHash = (static_cast<std::uint64_t>(set) + 1) * 0x9E3779B97F4A7C15ULL + vertices.size();
+        pivotHash ^= pivotHash >> 31;
+        const std::uint32_t pivotVertex = vertices[pivotHash % vertices.size()];
+        const std::uint32_t forwardSet = nextSet.fetch_add(2, std::memory_order_relaxed);
+        const std::uint32_t backwardSet = forwardSet + 1;
+        const std::uint32_t component = nextComponent.fetch_add(1, std::memory_order_relaxed);
+        std::vector<std::uint32_t> searchQueue;
+
+        // Forward; set -> forwardSet
+        setOf[pivotVertex].store(forwardSet, std::memory_order_relaxed);
+        searchQueue.push_back(pivotVertex);
+        for (std::size_t readIndex = 0; readIndex < searchQueue.size(); readIndex++) {
+            const std::uint32_t vertex = searchQueue[readIndex];
+            for (std::uint32_t edgeIndex = graph.offsets[vertex]; edgeIndex < graph.offsets[vertex + 1]; edgeIndex++) {
+                const std::uint32_t adjacentVertex = graph.targets[edgeIndex];
+                if (setOf[adjacentVertex].load(std::memory_order_relaxed) == set) {
+                    setOf[adjacentVertex].store(forwardSet, std::memory_order_relaxed);
+                    searchQueue.push_back(adjacentVertex);
+                }
+            }
+        }
+
+        // Backward; forwardSet -> DONE (the component of the pivot), set -> backwardSet
+        searchQueue.clear();
+        setOf[pivotVertex].store(DONE, std::memory_order_relaxed);
+        components.componentOf[pivotVertex] = component;
+        searchQueue.push_back(pivotVertex);
+        for (std::size_t readIndex = 0; readIndex < searchQueue.size(); readIndex++) {
+            const std::uint32_t vertex = searchQueue[readIndex];
+            for (std::uint32_t edgeIndex = transposedGraph.offsets[vertex]; edgeIndex < transposedGraph.offsets[vertex + 1]; edgeIndex++) {
+                const std::uint32_t adjacentVertex = transposedGraph.targets[edgeIndex];
+                const std::uint32_t adjacentSet = setOf[adjacentVertex].load(std::memory_order_relaxed);
+                if (adjacentSet == forwardSet) {
+                    setOf[adjacentVertex].store(DONE, std::memory_order_relaxed);
+                    components.componentOf[adjacentVertex] = component;
+                    searchQueue.push_back(adjacentVertex);
+                } else if (adjacentSet == set) {
+                    setOf[adjacentVertex].store(backwardSet, std::memory_order_relaxed);
+                    searchQueue.push_back(adjacentVertex);
+                }
+            }
+        }
+
+        // Split the rest into the three new tasks
+        std::vector<std::uint32_t> forwardVertices, backwardVertices, otherVertices;
+        for (std::uint32_t vertex : vertices) {
+            const std::uint32_t vertexSet = setOf[vertex].load(std::memory_order_relaxed);
+            if (vertexSet == forwardSet)
+                forwardVertices.push_back(vertex);
+            else if (vertexSet == backwardSet)
+                backwardVertices.push_back(vertex);
+            else if (vertexSet == set)
+                otherVertices.push_back(vertex);
+        }
+        {
+            std::lock_guard<std::mutex> lock(taskQueueMutex);
+            if (!forwardVertices.empty())
+                taskQueue.push_back(std::make_pair(forwardSet, std::move(forwardVertices)));
+            if (!backwardVertices.empty())
+                taskQueue.push_back(std::make_pair(backwardSet, std::move(backwardVertices)));
+            if (!otherVertices.empty())
+                taskQueue.push_back(std::make_pair(set, std::move(otherVertices)));
+        }
+        taskQueueChanged.notify_all();
+    };
+
+    runThreads(numThreads, 1, [&](unsigned int, std::size_t, std::size_t) {
+        std::unique_lock<std::mutex> lock(taskQueueMutex);
+        while (true) {
+            taskQueueChanged.wait(lock, [&] { return !taskQueue.empty() || runningTasks == 0; });
+            if (taskQueue.empty())
+                break;      // No task is left, and none is running to make more
+            std::pair<std::uint32_t, std::vector<std::uint32_t>> task = std::move(taskQueue.front());
+            taskQueue.pop_front();
+            runningTasks++;
+            lock.unlock();
+            runTask(task.first, task.second);
+            lock.lock();
+            runningTasks--;
+            taskQueueChanged.notify_all();
+        }
+    });
+
+    components.numberOfComponents = nextComponent.load();
+    return components;
+}
+
+#endif // DEPTH_FIRST_SEARCH_ALGORITHMS_HPP
@@ -0,0 +1,84 @@
+/**
+ * @file direction_optimizing_bfs.cpp
+ * @brief Examples of the direction-optimizing BFS of direction_optimizing_bfs.hpp; the distances and parents over a small directed graph,
+ *        and the steps taken over a larger low-diameter graph in each mode
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread direction_optimizing_bfs.cpp -o direction_optimizing_bfs
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <utility>
+#include <cstdint>
+#include "compressed_sparse_row_graph.hpp"
+#include "direction_optimizing_bfs.hpp"
+
+// A helper method to print the distance and the parent of every vertex
+void displayBfsResult(const BfsResult& result) {
+    for (std::size_t vertex = 0; vertex < result.distances.size(); vertex++) {
+        std::cout << "VERTEX " << vertex << ": ";
+        if (result.distances[vertex] == DirectionOptimizingBFS<std::uint32_t>::UNREACHED) {
+            std::cout << "unreached" << std::endl;
+        } else {
+            std::cout << "distance " << result.distances[vertex] << ", parent " << result.parents[vertex] << std::endl;
+        }
+    }
+}
+
+// A helper method to print the statistics of a search
+void displayBfsStatistics(const std::string& modeName, const BfsStatistics& statistics) {
+    std::cout << modeName << ": levels " << statistics.levels << ", top-down steps " << statistics.topDownSteps
+              << ", bottom-up steps " << statistics.bottomUpSteps << ", edges examined " << statistics.edgesExamined << std::endl;
+}
+
+int main(void) {
+    // The directed graph with 5 vertices of breadth_first_search_via_adjacent_list.c; the bottom-up steps need its transposed graph
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges = {{0, 1}, {0, 2}, {1, 2}, {2, 0}, {2, 3}, {3, 3}, {3, 4}};
+    CsrGraph<std::uint32_t> graph = buildCsrGraph(5, edges);
+    CsrGraph<std::uint32_t> transposedGraph = transposeCsrGraph(graph);
+    DirectionOptimizingBFS<std::uint32_t> bfs(graph, transposedGraph);
+
+    std::cout << "BFS from vertex 2:" << std::endl;
+    displayBfsResult(bfs.search(2));
+    std::cout << "BFS from vertex 3:" << std::endl;
+    displayBfsResult(bfs.search(3));
+
+    // An undirected random graph with 100000 vertices and average degree 16; a few levels hold most of the vertices
+    const std::uint32_t numberOfVertices = 100000;
+    std::mt19937 randomEngine(20240801);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> randomEdges;
+    for (std::uint32_t index = 0; index < numberOfVertices * 8; index++) {
+        std::uint32_t source = randomEngine() % numberOfVertices, destination = randomEngine() % numberOfVertices;
+        randomEdges.emplace_back(source, destination);
+        randomEdges.emplace_back(destination, source);
+    }
+    CsrGraph<std::uint32_t> randomGraph = buildCsrGraph(numberOfVertices, randomEdges);
+    DirectionOptimizingBFS<std::uint32_t> randomGraphBfs(randomGraph, randomGraph);
+
+    BfsStatistics topDownStatistics, directionOptimizingStatistics;
+    BfsResult topDownResult = randomGraphBfs.search(0, BfsMode::TopDown, &topDownStatistics);
+    BfsResult directionOptimizingResult = randomGraphBfs.search(0, BfsMode::DirectionOptimizing, &directionOptimizingStatistics);
+    displayBfsStatistics("Top-down", topDownStatistics);
+    displayBfsStatistics("Direction-optimizing", directionOptimizingStatistics);
+    std::cout << "Same distances: " << (topDownResult.distances == directionOptimizingResult.distances ? "Yes" : "No") << std::endl;
+
+    return 0;
+}
+
+// BFS from vertex 2:
+// VERTEX 0: distance 1, parent 2
+// VERTEX 1: distance 2, parent 0
+// VERTEX 2: distance 0, parent 2
+// VERTEX 3: distance 1, parent 2
+// VERTEX 4: distance 2, parent 3
+// BFS from vertex 3:
+// VERTEX 0: unreached
+// VERTEX 1: unreached
+// VERTEX 2: unreached
+// VERTEX 3: distance 0, parent 3
+// VERTEX 4: distance 1, parent 3
+// Top-down: levels 7, top-down steps 7, bottom-up steps 0, edges examined 1600000
+// Direction-optimizing: levels 7, top-down steps 5, bottom-up steps 2, edges examined 197298
+// Same distances: Yes
@@ -0,0 +1,281 @@
+/**
+ * @file direction_optimizing_bfs.hpp
+ * @brief Direction-optimizing Breadth First Search (BFS) over a CSR graph (compressed_sparse_row_graph.hpp), parallelized over threads
+ *        A top-down step expands the frontier (a queue) by the outgoing edges of its vertices, which is cheap while the frontier is small.
+ *        A bottom-up step lets every unvisited vertex look for a parent among its incoming edges in the frontier (a bitmap), and stop at the first one;
+ *        when the frontier holds a large part of the graph (the middle levels of a low-diameter graph), it examines far fewer edges.
+ *        The search switches between the two by the frontier-size heuristic of Beamer et al. ("Direction-Optimizing Breadth-First Search", 2012).
+ *        It is shared by direction_optimizing_bfs.cpp (example) and bfs_benchmark.cpp (benchmark).
+ */
+
+#ifndef DIRECTION_OPTIMIZING_BFS_HPP
+#define DIRECTION_OPTIMIZING_BFS_HPP
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include "compressed_sparse_row_graph.hpp"
+
+// The steps a search may take
+//  - TopDown: only top-down steps (a parallel version of the classic queue-based BFS).
+//  - DirectionOptimizing: top-down and bottom-up steps, switched by the frontier size.
+enum class BfsMode {
+    TopDown,
+    DirectionOptimizing
+};
+
+// The result of a search; distances[v] is the number of edges from the source to v, and parents[v] is the vertex v was reached from
+// (the source is its own parent). An unreached vertex has UNREACHED for both.
+struct BfsResult {
+    std::vector<std::uint32_t> distances;
+    std::vector<std::uint32_t> parents;
+};
+
+// The statistics of a search
+struct BfsStatistics {
+    std::size_t levels = 0;             // The number of steps (the largest distance + 1)
+    std::size_t topDownSteps = 0;
+    std::size_t bottomUpSteps = 0;
+    std::size_t edgesExamined = 0;      // The number of edges looked at by all steps
+};
+
+// A BFS over a CSR graph and its transposed graph (the incoming edges, for the bottom-up steps)
+// For an undirected graph (each edge stored in both directions), the graph is its own transpose, so pass it twice.
+template <typename EdgeWeightType>
+class DirectionOptimizingBFS {
+private:
+    static constexpr std::uint32_t BITS_PER_WORD = 64;
+
+    const CsrGraph<EdgeWeightType>& graph;
+    const CsrGraph<EdgeWeightType>& transposedGraph;
+    unsigned int numThreads;
+    double alpha;       // Switch to bottom-up when the edges out of the frontier exceed the edges into the unvisited vertices / alpha
+    double beta;        // Switch back to top-down when the frontier shrinks below n / beta vertices
+
+    void parallelFor(std::size_t count, std::size_t grainSize, const std::function<void(unsigned int, std::size_t, std::size_t)>& body) const;
+
+    // Helper method to find the index of the lowest set bit of a nonzero word
+    static unsigned int countTrailingZeros(std::uint64_t word) {
+#if defined(__GNUC__)
+        return static_cast<unsigned int>(__builtin_ctzll(word));
+#else
+        unsigned int count = 0;
+        while ((word & 1) == 0) {
+            word >>= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+public:
+    static constexpr std::uint32_t UNREACHED = UINT32_MAX;
+
+    DirectionOptimizingBFS(const CsrGraph<EdgeWeightType>& graph, const CsrGraph<EdgeWeightType>& transposedGraph,
+                           unsigned int numThreads = std::thread::hardware_concurrency(), double alpha = 15.0, double beta = 18.0)
+        : graph(graph), transposedGraph(transposedGraph), alpha(alpha), beta(beta) {
+        if (graph.getNumberOfVertices() != transposedGraph.getNumberOfVertices() || graph.getNumberOfEdges() != transposedGraph.getNumberOfEdges()) {
+            throw std::invalid_argument("The transposed graph does not match the graph");
+        }
+        this->numThreads = (numThreads == 0) ? 1 : numThreads;
+    }
+
+    BfsResult search(std::uint32_t sourceVertex, BfsMode mode = BfsMode::DirectionOptimizing, BfsStatistics* statistics = nullptr) const;
+};
+
+template <typename EdgeWeightType>
+constexpr std::uint32_t DirectionOptimizingBFS<EdgeWeightType>::BITS_PER_WORD;
+template <typename EdgeWeightType>
+constexpr std::uint32_t DirectionOptimizingBFS<EdgeWeightType>::UNREACHED;
+
+// Helper method to split [0, count) into one contiguous chunk per thread (of at least grainSize items) and run body(threadIndex, begin, end) on each
+template <typename EdgeWeightType>
+void DirectionOptimizingBFS<EdgeWeightType>::parallelFor(std::size_t count, std::size_t grainSize,
+                                                         const std::function<void(unsigned int, std::size_t, std::size_t)>& body) const {
+    unsigned int numChunks = static_cast<unsigned int>(std::min<std::size_t>(this->numThreads, std::max<std::size_t>(count / grainSize, 1)));
+    std::vector<std::thread> threads;
+    for (unsigned int chunkIndex = 1; chunkIndex < numChunks; chunkIndex++) {
+        threads.emplace_back(body, chunkIndex, count * chunkIndex / numChunks, count * (chunkIndex + 1) / numChunks);
+    }
+    body(0, 0, count / numChunks);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Function to run a BFS from sourceVertex
+// The parents are claimed by compare-and-swap in the top-down steps, so the vertex reached from several frontier vertices at once
+// gets exactly one parent; the distances do not depend on the thread interleaving (the parents may).
+template <typename EdgeWeightType>
+BfsResult DirectionOptimizingBFS<EdgeWeightType>::search(std::uint32_t sourceVertex, BfsMode mode, BfsStatistics* statistics) const {
+    const std::uint32_t numberOfVertices = this->graph.getNumberOfVertices();
+    if (sourceVertex >= numberOfVertices) {
+        throw std::out_of_range("Invalid source vertex");
+    }
+    const std::size_t numberOfWords = (static_cast<std::size_t>(numberOfVertices) + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    BfsResult result;
+    result.distances.assign(numberOfVertices, UNREACHED);
+    std::vector<std::atomic<std::uint32_t>> parents(numberOfVertices);
+    parallelFor(numberOfVertices, 1 << 16, [&](unsigned int, std::size_t begin, std::size_t end) {
+        for (std::size_t vertex = begin; vertex < end; vertex++) {
+            parents[vertex].store(UNREACHED, std::memory_order_relaxed);
+        }
+    });
+    parents[sourceVertex].store(sourceVertex, std::memory_order_relaxed);
+    result.distances[sourceVertex] = 0;
+
+    // The frontier is a queue in the top-down steps and a bitmap in the bottom-up steps
+    std::vector<std::uint32_t> frontierQueue(1, sourceVertex);
+    std::vector<std::atomic<std::uint64_t>> frontierBitmap(numberOfWords), nextBitmap(numberOfWords);
+    std::size_t frontierSize = 1, previousFrontierSize = 0;
+    bool isBottomUp = false;
+
+    // The per-thread results of a step, merged after it
+    std::vector<std::vector<std::uint32_t>> nextQueuePerThread(this->numThreads);
+    std::vector<std::size_t> frontierEdgesPerThread(this->numThreads), reachedInEdgesPerThread(this->numThreads);
+    std::vector<std::size_t> reachedPerThread(this->numThreads), edgesExaminedPerThread(this->numThreads);
+
+    // The work of each kind of step; the edges out of the frontier (top-down) and the edges into the unvisited vertices (bottom-up)
+    std::size_t frontierEdges = this->graph.getDegree(sourceVertex);
+    std::size_t unvisitedInEdges = this->transposedGraph.getNumberOfEdges() - this->transposedGraph.getDegree(sourceVertex);
+    BfsStatistics searchStatistics;
+
+    for (std::uint32_t level = 0; frontierSize > 0; level++) {
+        const std::size_t currentFrontierSize = frontierSize;
+        for (unsigned int threadIndex = 0; threadIndex < this->numThreads; threadIndex++) {
+            nextQueuePerThread[threadIndex].clear();
+            frontierEdgesPerThread[threadIndex] = reachedInEdgesPerThread[threadIndex] = 0;
+            reachedPerThread[threadIndex] = edgesExaminedPerThread[threadIndex] = 0;
+        }
+
+        // Choose the direction of this step, converting the frontier if it changes
+        if (!isBottomUp && mode == BfsMode::DirectionOptimizing && static_cast<double>(frontierEdges) > static_cast<double>(unvisitedInEdges) / this->alpha) {
+            parallelFor(numberOfWords, 1 << 12, [&](unsigned int, std::size_t begin, std::size_t end) {
+                for (std::size_t wordIndex = begin; wordIndex < end; wordIndex++) {
+                    frontierBitmap[wordIndex].store(0, std::memory_order_relaxed);
+                }
+            });
+            parallelFor(frontierQueue.size(), 1 << 12, [&](unsigned int, std::size_t begin, std::size_t end) {
+                for (std::size_t index = begin; index < end; index++) {
+                    std::uint32_t vertex = frontierQueue[index];
+                    frontierBitmap[vertex / BITS_PER_WORD].fetch_or(std::uint64_t(1) << (vertex % BITS_PER_WORD), std::memory_order_relaxed);
+                }
+            });
+            isBottomUp = true;
+        } else if (isBottomUp && frontierSize < previousFrontierSize && static_cast<double>(frontierSize) < static_cast<double>(numberOfVertices) / this->beta) {
+            // The frontier is shrinking and small again; collect its vertices in ascending order
+            parallelFor(numberOfWords, 1 << 12, [&](unsigned int threadIndex, std::size_t begin, std::size_t end) {
+                std::vector<std::uint32_t>& nextQueue = nextQueuePerThread[threadIndex];
+                for (std::size_t wordIndex = begin; wordIndex < end; wordIndex++) {
+                    std::uint64_t word = frontierBitmap[wordIndex].load(std::memory_order_relaxed);
+                    for (; word != 0; word &= word - 1) {
+                        nextQueue.push_back(static_cast<std::uint32_t>(wordIndex * BITS_PER_WORD + countTrailingZeros(word)));
+                    }
+                }
+            });
+            frontierQueue.clear();
+            for (std::vector<std::uint32_t>& nextQueue : nextQueuePerThread) {
+                frontierQueue.insert(frontierQueue.end(), nextQueue.begin(), nextQueue.end());
+                nextQueue.clear();
+            }
+            isBottomUp = false;
+        }
+
+        if (!isBottomUp) {
+            // Top-down step; every frontier vertex claims its unvisited neighbors
+            parallelFor(frontierQueue.size(), 1 << 10, [&](unsigned int threadIndex, std::size_t begin, std::size_t end) {
+                std::vector<std::uint32_t>& nextQueue = nextQueuePerThread[threadIndex];
+                std::size_t newFrontierEdges = 0, reachedInEdges = 0, edgesExamined = 0;
+                for (std::size_t index = begin; index < end; index++) {
+                    const std::uint32_t vertex = frontierQueue[index];
+                    for (std::uint32_t edgeIndex = this->graph.offsets[vertex]; edgeIndex < this->graph.offsets[vertex + 1]; edgeIndex++) {
+                        const std::uint32_t adjacentVertex = this->graph.targets[edgeIndex];
+                        edgesExamined++;
+                        std::uint32_t expectedParent = UNREACHED;
+                        if (parents[adjacentVertex].load(std::memory_order_relaxed) == UNREACHED &&
+                            parents[adjacentVertex].compare_exchange_strong(expectedParent, vertex, std::memory_order_relaxed)) {
+                            result.distances[adjacentVertex] = level + 1;
+                            nextQueue.push_back(adjacentVertex);
+                            newFrontierEdges += this->graph.getDegree(adjacentVertex);
+                            reachedInEdges += this->transposedGraph.getDegree(adjacentVertex);
+                        }
+                    }
+                }
+                frontierEdgesPerThread[threadIndex] = newFrontierEdges;
+                reachedInEdgesPerThread[threadIndex] = reachedInEdges;
+                edgesExaminedPerThread[threadIndex] = edgesExamined;
+            });
+            frontierQueue.clear();
+            for (const std::vector<std::uint32_t>& nextQueue : nextQueuePerThread) {
+                frontierQueue.insert(frontierQueue.end(), nextQueue.begin(), nextQueue.end());
+                reachedPerThread[0] += nextQueue.size();
+            }
+            searchStatistics.topDownSteps++;
+        } else {
+            // Bottom-up step; every unvisited vertex looks for a parent in the frontier
+            // A thread owns whole words of the bitmaps (64 vertices each), so the next frontier is written without atomic read-modify-writes.
+            parallelFor(numberOfWords, 1 << 8, [&](unsigned int threadIndex, std::size_t begin, std::size_t end) {
+                std::size_t newFrontierEdges = 0, reachedInEdges = 0, reached = 0, edgesExamined = 0;
+                for (std::size_t wordIndex = begin; wordIndex < end; wordIndex++) {
+                    std::uint64_t nextWord = 0;
+                    const std::uint32_t firstVertex = static_cast<std::uint32_t>(wordIndex * BITS_PER_WORD);
+                    const std::uint32_t lastVertex = std::min<std::uint32_t>(firstVertex + BITS_PER_WORD, numberOfVertices);
+                    for (std::uint32_t vertex = firstVertex; vertex < lastVertex; vertex++) {
+                        if (parents[vertex].load(std::memory_order_relaxed) != UNREACHED)
+                            continue;
+                        for (std::uint32_t edgeIndex = this->transposedGraph.offsets[vertex]; edgeIndex < this->transposedGraph.offsets[vertex + 1]; edgeIndex++) {
+                            const std::uint32_t adjacentVertex = this->transposedGraph.targets[edgeIndex];
+                            edgesExamined++;
+                            if ((frontierBitmap[adjacentVertex / BITS_PER_WORD].load(std::memory_order_relaxed) >> (adjacentVertex % BITS_PER_WORD)) & 1) {
+                                parents[vertex].store(adjacentVertex, std::memory_order_relaxed);
+                                result.distances[vertex] = level + 1;
+                                nextWord |= std::uint64_t(1) << (vertex - firstVertex);
+                                newFrontierEdges += this->graph.getDegree(vertex);
+                                reachedInEdges += this->transposedGraph.getDegree(vertex);
+                                reached++;
+                                break;
+                            }
+                        }
+                    }
+                    nextBitmap[wordIndex].store(nextWord, std::memory_order_relaxed);
+                }
+                frontierEdgesPerThread[threadIndex] = newFrontierEdges;
+                reachedInEdgesPerThread[threadIndex] = reachedInEdges;
+                reachedPerThread[threadIndex] = reached;
+                edgesExaminedPerThread[threadIndex] = edgesExamined;
+            });
+            frontierBitmap.swap(nextBitmap);
+            searchStatistics.bottomUpSteps++;
+        }
+
+        frontierEdges = 0;
+        frontierSize = 0;
+        for (unsigned int threadIndex = 0; threadIndex < this->numThreads; threadIndex++) {
+            frontierEdges += frontierEdgesPerThread[threadIndex];
+            unvisitedInEdges -= reachedInEdgesPerThread[threadIndex];
+            frontierSize += reachedPerThread[threadIndex];
+            searchStatistics.edgesExamined += edgesExaminedPerThread[threadIndex];
+        }
+        previousFrontierSize = currentFrontierSize;
+        searchStatistics.levels++;
+    }
+
+    result.parents.resize(numberOfVertices);
+    parallelFor(numberOfVertices, 1 << 16, [&](unsigned int, std::size_t begin, std::size_t end) {
+        for (std::size_t vertex = begin; vertex < end; vertex++) {
+            result.parents[vertex] = parents[vertex].load(std::memory_order_relaxed);
+        }
+    });
+    if (statistics != nullptr) {
+        *statistics = searchStatistics;
+    }
+    return result;
+}
+
+#endif // DIRECTION_OPTIMIZING_BFS_HPP
@@ -0,0 +1,63 @@
+/**
+ * @file disjoint_set.cpp
+ * @brief Examples of the disjoint set (union-find) of disjoint_set.hpp; connected components of a graph, and grouping duplicate records
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <map>
+#include "disjoint_set.hpp"
+
+int main(void) {
+    // Connected components of a graph with 8 vertices (0 ~ 7)
+    DisjointSet components(8);
+    std::vector<std::pair<int, int>> edges = {{0, 1}, {1, 2}, {3, 4}, {5, 6}, {6, 7}, {7, 5}};
+    for (const auto& edge : edges) {
+        components.unite(edge.first, edge.second);
+    }
+    std::cout << "Number of connected components: " << components.getNumberOfSets() << std::endl;
+
+    // The roots of every vertex at once
+    std::vector<int> vertices = {0, 1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> roots(vertices.size());
+    components.findMany(vertices.data(), vertices.size(), roots.data());
+    std::map<int, std::vector<int>> verticesByRoot;
+    for (std::size_t index = 0; index < vertices.size(); index++) {
+        verticesByRoot[roots[index]].push_back(vertices[index]);
+    }
+    for (const auto& component : verticesByRoot) {
+        std::cout << "Component (size " << components.getSetSize(component.first) << "):";
+        for (int vertex : component.second) {
+            std::cout << " " << vertex;
+        }
+        std::cout << std::endl;
+    }
+
+    // Grouping duplicate records; the records arrive one by one (grow by addElement), and each detected duplicate pair is united
+    DisjointSet duplicates;
+    duplicates.reserve(6);
+    std::vector<std::string> records = {"Alice Kim", "alice kim", "Bob Lee", "Robert Lee", "ALICE KIM", "Carol Park"};
+    for (std::size_t index = 0; index < records.size(); index++) {
+        duplicates.addElement();
+    }
+    std::vector<std::pair<int, int>> duplicatePairs = {{0, 1}, {2, 3}, {1, 4}};
+    for (const auto& duplicatePair : duplicatePairs) {
+        duplicates.unite(duplicatePair.first, duplicatePair.second);
+    }
+    std::cout << "Unique records: " << duplicates.getNumberOfSets() << " out of " << duplicates.getNumberOfElements() << std::endl;
+    std::cout << "Is \"" << records[0] << "\" the same as \"" << records[4] << "\"? " << (duplicates.isSameSet(0, 4) ? "Yes" : "No") << std::endl;
+    std::cout << "Is \"" << records[0] << "\" the same as \"" << records[2] << "\"? " << (duplicates.isSameSet(0, 2) ? "Yes" : "No") << std::endl;
+
+    return 0;
+}
+
+// Number of connected components: 3
+// Component (size 3): 0 1 2
+// Component (size 2): 3 4
+// Component (size 3): 5 6 7
+// Unique records: 3 out of 6
+// Is "Alice Kim" the same as "ALICE KIM"? Yes
+// Is "Alice Kim" the same as "Bob Lee"? No
@@ -0,0 +1,119 @@
+/**
+ * @file disjoint_set.hpp
+ * @brief Disjoint set (union-find) implementation in C++ language
+ *        Disjoint set is a data structure that keeps track of a set of elements partitioned into a number of disjoint (non-overlapping) subsets.
+ *        The whole structure is a single array; a non-root element stores the index of its parent, and a root stores the negated size of its set.
+ *        Find is iterative with path halving (so a long chain cannot overflow the stack), and unite links the smaller set under the larger one.
+ *        It is shared by kruskal_mst.hpp and the other programs grouping elements (e.g. connected components, deduplication).
+ */
+
+#ifndef DISJOINT_SET_HPP
+#define DISJOINT_SET_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+// Define the structure for disjoint set
+class DisjointSet {
+private:
+    std::vector<int> parentOrNegativeSize;      // parent index (>= 0) for a non-root element, -(size of the set) for a root
+    std::size_t numberOfSets;
+
+    static constexpr std::size_t FIND_MANY_PREFETCH_DISTANCE = 8;   // How far ahead findMany prefetches
+
+public:
+    // constructor; grow checks that the elements fit in int indices
+    DisjointSet(unsigned int numberOfElements = 0) : numberOfSets(0) { grow(numberOfElements); }
+
+    void reserve(unsigned int capacity) { this->parentOrNegativeSize.reserve(capacity); }   // Method to preallocate for grow
+    void grow(unsigned int numberOfElements);                                               // Method to add singleton sets up to numberOfElements
+    unsigned int addElement();                                                              // Method to add a singleton set, returning its element
+
+    int findParentVertex(int targetVertex);                                                 // Method to find the root of the set of an element
+    void findMany(const int* targetVertices, std::size_t count, int* roots);                // Method to find the roots of many elements at once
+    bool unite(int vertex1, int vertex2);                                                   // Method to unite two sets (false if already the same)
+
+    bool isSameSet(int vertex1, int vertex2) { return findParentVertex(vertex1) == findParentVertex(vertex2); }
+    unsigned int getSetSize(int vertex) { return static_cast<unsigned int>(-this->parentOrNegativeSize[findParentVertex(vertex)]); }
+    std::size_t getNumberOfElements() const { return this->parentOrNegativeSize.size(); }
+    std::size_t getNumberOfSets() const { return this->numberOfSets; }
+};
+
+// Method to add singleton sets for the elements [getNumberOfElements(), numberOfElements)
+inline void DisjointSet::grow(unsigned int numberOfElements) {
+    if (numberOfElements > static_cast<unsigned int>(INT32_MAX)) {
+        throw std::length_error("Too many elements for int indices");
+    }
+    if (numberOfElements > this->parentOrNegativeSize.size()) {
+        this->numberOfSets += numberOfElements - this->parentOrNegativeSize.size();
+        this->parentOrNegativeSize.resize(numberOfElements, -1);
+    }
+}
+
+// Method to add a singleton set, returning its element
+inline unsigned int DisjointSet::addElement() {
+    unsigned int element = static_cast<unsigned int>(this->parentOrNegativeSize.size());
+    grow(element + 1);
+    return element;
+}
+
+// Method to find the root of the set of an element
+// Path halving; every visited element is linked to its grandparent, which halves the path for the next finds in one pass.
+inline int DisjointSet::findParentVertex(int targetVertex) {
+    while (this->parentOrNegativeSize[targetVertex] >= 0) {
+        int parentVertex = this->parentOrNegativeSize[targetVertex];
+        int grandparentVertex = this->parentOrNegativeSize[parentVertex];
+        if (grandparentVertex < 0)
+            return parentVertex;
+        this->parentOrNegativeSize[targetVertex] = grandparentVertex;
+        targetVertex = grandparentVertex;
+    }
+    return targetVertex;
+}
+
+// Method to find the roots of many elements at once (roots[i] is the root of targetVertices[i])
+// A single find is a chain of dependent cache misses on a large array. Here the finds are software-pipelined with prefetches;
+// the element FIND_MANY_PREFETCH_DISTANCE * 2 ahead is prefetched, and the parent of the element FIND_MANY_PREFETCH_DISTANCE ahead
+// (already in the cache by then) is prefetched, so the first two steps of each find usually hit the cache.
+inline void DisjointSet::findMany(const int* targetVertices, std::size_t count, int* roots) {
+    for (std::size_t index = 0; index < count; index++) {
+#if defined(__GNUC__)
+        if (index + 2 * FIND_MANY_PREFETCH_DISTANCE < count) {
+            __builtin_prefetch(&this->parentOrNegativeSize[targetVertices[index + 2 * FIND_MANY_PREFETCH_DISTANCE]], 1);
+        }
+        if (index + FIND_MANY_PREFETCH_DISTANCE < count) {
+            int parentVertex = this->parentOrNegativeSize[targetVertices[index + FIND_MANY_PREFETCH_DISTANCE]];
+            if (parentVertex >= 0) {
+                __builtin_prefetch(&this->parentOrNegativeSize[parentVertex], 1);
+            }
+        }
+#endif
+        roots[index] = findParentVertex(targetVertices[index]);
+    }
+}
+
+// Method to unite (union) two sets, returning false if they are already the same set
+// Union by size; the root of the smaller set is linked under the root of the larger one, so a tree is never deeper than log2(n).
+inline bool DisjointSet::unite(int vertex1, int vertex2) {
+    int root1 = findParentVertex(vertex1);
+    int root2 = findParentVertex(vertex2);
+    if (root1 == root2)
+        return false;
+
+    // The sizes are negated, so the larger set has the smaller value
+    if (this->parentOrNegativeSize[root1] > this->parentOrNegativeSize[root2]) {
+        int swappedRoot = root1;
+        root1 = root2;
+        root2 = swappedRoot;
+    }
+    this->parentOrNegativeSize[root1] += this->parentOrNegativeSize[root2];
+    this->parentOrNegativeSize[root2] = root1;
+    this->numberOfSets--;
+    return true;
+}
+
+constexpr std::size_t DisjointSet::FIND_MANY_PREFETCH_DISTANCE;
+
+#endif // DISJOINT_SET_HPP
@@ -4,6 +4,13 @@
  *        Note that the graph is directed graph.
  *        For convenience, the graph is managed by unordered_map (vertex to index) and vector (index to vertex).
  *        The this->vertexToIndex and indexToVertex mappings help manage the conversion between vertex names and their corresponding indices in the adjacency matrix.
+ *        The adjacency matrix is a single contiguous row-major bit matrix (64 edges per word), each row padded to whole words.
+ *        Its capacity (the number of rows, and the bits in a row) grows geometrically, so adding a vertex is amortized O(n / 64) word operations,
+ *        and the neighbors of a vertex are found a word at a time with count-trailing-zeros scans.
+ *        On top of the bit rows, set intersections are an AND plus a popcount of the rows, which gives fast analytics kernels for dense graphs:
+ *        triangle counting, common neighbors, k-hop reachability and Warshall's transitive closure (AVX2 popcount when available).
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -mavx2 graph_via_adjacent_matrix_advanced.cpp -o graph_via_adjacent_matrix_advanced
  */
 //
 
@@ -11,21 +18,115 @@
 #include <vector>
 #include <unordered_map>
 #include <stdexcept>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Helper function to count the set bits of a word
+inline unsigned int countSetBits(std::uint64_t word) {
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_popcountll(word));
+#else
+    unsigned int count = 0;
+    for (; word != 0; word &= word - 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+// Helper function to count the set bits of (words1 AND words2), i.e. the size of the intersection of two bit sets
+inline std::uint64_t countCommonBits(const std::uint64_t* words1, const std::uint64_t* words2, std::size_t numberOfWords) {
+    std::uint64_t count = 0;
+    std::size_t index = 0;
+#ifdef __AVX2__
+    // 4 words at a time; the popcount of each byte is looked up by its two nibbles (vpshufb), and the bytes are summed into 64-bit lanes (vpsadbw)
+    const __m256i nibbleCounts = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibbleMask = _mm256_set1_epi8(0x0f);
+    __m256i sums = _mm256_setzero_si256();
+    for (; index + 4 <= numberOfWords; index += 4) {
+        __m256i words = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(words1 + index)),
+                                         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words2 + index)));
+        __m256i lowCounts = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(words, lowNibbleMask));
+        __m256i highCounts = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(_mm256_srli_epi16(words, 4), lowNibbleMask));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_add_epi8(lowCounts, highCounts), _mm256_setzero_si256()));
+    }
+    count += static_cast<std::uint64_t>(_mm256_extract_epi64(sums, 0)) + static_cast<std::uint64_t>(_mm256_extract_epi64(sums, 1)) +
+             static_cast<std::uint64_t>(_mm256_extract_epi64(sums, 2)) + static_cast<std::uint64_t>(_mm256_extract_epi64(sums, 3));
+#endif
+    for (; index < numberOfWords; index++) {
+        count += countSetBits(words1[index] & words2[index]);
+    }
+    return count;
+}
+
+// The ways removeVertex can renumber the remaining vertices
+//  - PreserveOrder: the later vertices move down by one index, keeping their order (O(n^2 / 64) word operations, as every row shifts).
+//  - SwapWithLast: the last vertex takes the index of the removed one (O(n); one row and one column move).
+enum class VertexRemovalMode {
+    PreserveOrder,
+    SwapWithLast
+};
+
+// Helper function to find the index of the lowest set bit of a nonzero word
+inline unsigned int countTrailingZeros(std::uint64_t word) {
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctzll(word));
+#else
+    unsigned int count = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
 
 // The vertices and edges will be dynamically allocated
 template <typename GraphVertexType>
 class GraphViaAdjacentMatrix {
 private:
+    static constexpr unsigned int BITS_PER_WORD = 64;
+    static constexpr unsigned int INITIAL_CAPACITY = 64;
+
     unsigned int numberOfVertices;                                      // The number of vertices in the graph
     unsigned int numberOfEdges;                                         // The number of edges in the graph
-    std::vector<std::vector<bool>> adjacentMatrix;                      // Adjacent matrix to store the edges
+    unsigned int capacity;                                              // The number of vertices the matrix has room for
+    std::size_t wordsPerRow;                                            // The stride of a row in words (capacity rounded up to whole words)
+    std::vector<std::uint64_t> adjacentMatrix;                          // Adjacent matrix to store the edges; bit (row, column) is the edge row -> column
     std::unordered_map<GraphVertexType, unsigned int> vertexToIndex;    // Map vertex to index (e.g., "A" -> 0, "B" -> 1, ...)
-    std::unordered_map<unsigned int, GraphVertexType> indexToVertex;    // Map index to vertex (e.g., 0 -> "A", 1 -> "B", ...)
+    std::vector<GraphVertexType> indexToVertex;                         // Map index to vertex (e.g., 0 -> "A", 1 -> "B", ...)
+
+    // Helper methods to access the bits of the adjacent matrix
+    // Invariant: every bit of a row or column at or beyond numberOfVertices is false.
+    // getRow(capacity) is the end of the matrix, so it is computed from data() rather than indexed.
+    std::uint64_t* getRow(unsigned int row) { return this->adjacentMatrix.data() + row * this->wordsPerRow; }
+    const std::uint64_t* getRow(unsigned int row) const { return this->adjacentMatrix.data() + row * this->wordsPerRow; }
+    bool hasEdgeAt(unsigned int row, unsigned int column) const {
+        return (getRow(row)[column / BITS_PER_WORD] >> (column % BITS_PER_WORD)) & 1;
+    }
+    void setEdgeAt(unsigned int row, unsigned int column, bool value) {
+        std::uint64_t mask = std::uint64_t(1) << (column % BITS_PER_WORD);
+        if (value)
+            getRow(row)[column / BITS_PER_WORD] |= mask;
+        else
+            getRow(row)[column / BITS_PER_WORD] &= ~mask;
+    }
+    void growCapacity(unsigned int minimumCapacity);
+    void eraseColumnFromRow(unsigned int row, unsigned int column);
+
 public:
     // Constructor to create a graph via adjacent matrix
     GraphViaAdjacentMatrix() {
         numberOfVertices = 0;
         numberOfEdges = 0;
+        capacity = 0;
+        wordsPerRow = 0;
     }
 
     // Destructor to clear the graph
@@ -36,13 +137,66 @@ public:
     }
 
     // Methods
+    void reserve(unsigned int numberOfVertices);
     void addVertex(GraphVertexType vertex);
     void addEdge(GraphVertexType sourceVertex, GraphVertexType destinationVertex, bool isDirected);
-    void removeVertex(GraphVertexType vertex);
+    void removeVertex(GraphVertexType vertex, VertexRemovalMode mode = VertexRemovalMode::PreserveOrder);
     void removeEdge(GraphVertexType sourceVertex, GraphVertexType destinationVertex, bool isDirected);
+    bool hasEdge(const GraphVertexType& sourceVertex, const GraphVertexType& destinationVertex) const;
+    template <typename Visitor>
+    void forEachNeighborIndex(unsigned int vertexIndex, Visitor visit) const;
+    std::vector<GraphVertexType> getNeighbors(const GraphVertexType& vertex) const;
     void displayGraph();
+
+    // Analytics kernels on the bit rows
+    std::uint64_t countTriangles() const;
+    std::uint64_t countCommonNeighbors(const GraphVertexType& vertex1, const GraphVertexType& vertex2) const;
+    std::vector<GraphVertexType> getVerticesWithinHops(const GraphVertexType& vertex, unsigned int numberOfHops) const;
+    GraphViaAdjacentMatrix computeTransitiveClosure() const;
 };
 
+template <typename GraphVertexType>
+constexpr unsigned int GraphViaAdjacentMatrix<GraphVertexType>::BITS_PER_WORD;
+template <typename GraphVertexType>
+constexpr unsigned int GraphViaAdjacentMatrix<GraphVertexType>::INITIAL_CAPACITY;
+
+// Helper method to grow the matrix to at least minimumCapacity vertices, at least doubling it
+// The rows are copied into a new matrix with the new stride; the new rows and columns are false.
+template <typename GraphVertexType>
+void GraphViaAdjacentMatrix<GraphVertexType>::growCapacity(unsigned int minimumCapacity) {
+    if (minimumCapacity <= this->capacity)
+        return;
+    unsigned int newCapacity = std::max(std::max(minimumCapacity, INITIAL_CAPACITY), this->capacity * 2);
+    std::size_t newWordsPerRow = (newCapacity + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    std::vector<std::uint64_t> newMatrix(static_cast<std::size_t>(newCapacity) * newWordsPerRow, 0);
+    for (unsigned int row = 0; row < this->numberOfVertices; row++) {
+        std::copy(getRow(row), getRow(row) + this->wordsPerRow, &newMatrix[row * newWordsPerRow]);
+    }
+    this->adjacentMatrix.swap(newMatrix);
+    this->capacity = newCapacity;
+    this->wordsPerRow = newWordsPerRow;
+}
+
+// Helper method to erase a column from a row, shifting the bits of the later columns down by one
+template <typename GraphVertexType>
+void GraphViaAdjacentMatrix<GraphVertexType>::eraseColumnFromRow(unsigned int row, unsigned int column) {
+    std::uint64_t* words = getRow(row);
+    std::size_t wordIndex = column / BITS_PER_WORD;
+    std::uint64_t lowMask = (std::uint64_t(1) << (column % BITS_PER_WORD)) - 1;
+    words[wordIndex] = (words[wordIndex] & lowMask) | ((words[wordIndex] >> 1) & ~lowMask);
+    for (; wordIndex + 1 < this->wordsPerRow; wordIndex++) {
+        words[wordIndex] |= words[wordIndex + 1] << (BITS_PER_WORD - 1);
+        words[wordIndex + 1] >>= 1;
+    }
+}
+
+// Reserve room for numberOfVertices vertices, so adding up to that many vertices does not reallocate the matrix
+template <typename GraphVertexType>
+void GraphViaAdjacentMatrix<GraphVertexType>::reserve(unsigned int numberOfVertices) {
+    growCapacity(numberOfVertices);
+}
+
 // Add a vertex to the graph
 template <typename GraphVertexType>
 void GraphViaAdjacentMatrix<GraphVertexType>::addVertex(GraphVertexType vertex) {
@@ -50,20 +204,13 @@ void GraphViaAdjacentMatrix<GraphVertexType>::addVertex(GraphVertexType vertex)
         throw std::invalid_argument("Vertex already exists");
     }
 
+    // The new row and column are already false (see the invariant), so only the capacity may need to grow
+    growCapacity(numberOfVertices + 1);
+
     unsigned int index = numberOfVertices;
     vertexToIndex[vertex] = index;
-    indexToVertex[index] = vertex;
+    indexToVertex.push_back(vertex);
     numberOfVertices++;
-    
-    this->adjacentMatrix.resize(numberOfVertices);
-    for (unsigned int index = 0; index < numberOfVertices; index++)
-        this->adjacentMatrix[index].resize(numberOfVertices);
-
-    // Initialize the new row and column
-    for (unsigned int index = 0; index < numberOfVertices; index++) {
-        this->adjacentMatrix[numberOfVertices - 1][index] = false;
-        this->adjacentMatrix[index][numberOfVertices - 1] = false;
-    }
 }
 
 // Add an edge to the graph
@@ -76,46 +223,65 @@ void GraphViaAdjacentMatrix<GraphVertexType>::addEdge(GraphVertexType sourceVert
     unsigned int sourceIndex = vertexToIndex[sourceVertex];
     unsigned int destinationIndex = vertexToIndex[destinationVertex];
 
-    this->adjacentMatrix[sourceIndex][destinationIndex] = true;
+    setEdgeAt(sourceIndex, destinationIndex, true);
     this->numberOfEdges++;
     if (!isDirected) {
         // If the edge is undirected, add the reverse edge
-        this->adjacentMatrix[destinationIndex][sourceIndex] = true;
+        setEdgeAt(destinationIndex, sourceIndex, true);
         this->numberOfEdges++;      // Considering the reverse edge
     }
 }
 
 // Remove a vertex from the graph
 template <typename GraphVertexType>
-void GraphViaAdjacentMatrix<GraphVertexType>::removeVertex(GraphVertexType vertex) {
+void GraphViaAdjacentMatrix<GraphVertexType>::removeVertex(GraphVertexType vertex, VertexRemovalMode mode) {
     if (vertexToIndex.find(vertex) == vertexToIndex.end()) {
         throw std::out_of_range("Invalid vertex");
     }
 
     unsigned int indexToRemove = vertexToIndex[vertex];
+    unsigned int lastIndex = numberOfVertices - 1;
 
-    // Remove the vertex from the adjacent matrix
-    for (unsigned int vertexIndex = 0; vertexIndex < numberOfVertices; vertexIndex++) {
-        this->adjacentMatrix[indexToRemove][vertexIndex] = false;
-        this->adjacentMatrix[vertexIndex][indexToRemove] = false;
-    }
+    if (mode == VertexRemovalMode::SwapWithLast) {
+        // Move the last row and column into the place of the removed vertex, overwriting its edges
+        // (The row moves first, so an edge of the last vertex to itself moves along with the column)
+        if (indexToRemove != lastIndex) {
+            std::copy(getRow(lastIndex), getRow(lastIndex) + this->wordsPerRow, getRow(indexToRemove));
+            for (unsigned int row = 0; row < numberOfVertices; row++) {
+                setEdgeAt(row, indexToRemove, hasEdgeAt(row, lastIndex));
+                setEdgeAt(row, lastIndex, false);
+            }
+        } else {
+            for (unsigned int row = 0; row < numberOfVertices; row++) {
+                setEdgeAt(row, lastIndex, false);
+            }
+        }
+        std::fill(getRow(lastIndex), getRow(lastIndex) + this->wordsPerRow, 0);
 
-    // Remove the vertex from the graph
-    this->adjacentMatrix.erase(this->adjacentMatrix.begin() + indexToRemove);
-    for (auto& row : this->adjacentMatrix) {
-        row.erase(row.begin() + indexToRemove);
-    }
+        // Update the mappings; only the last vertex changes its index
+        vertexToIndex.erase(vertex);
+        if (indexToRemove != lastIndex) {
+            indexToVertex[indexToRemove] = indexToVertex[lastIndex];
+            vertexToIndex[indexToVertex[indexToRemove]] = indexToRemove;
+        }
+        indexToVertex.pop_back();
+    } else {
+        // Remove the vertex from the adjacent matrix; the later rows move up by one, then the later columns move left by one
+        std::copy(getRow(indexToRemove + 1), getRow(numberOfVertices), getRow(indexToRemove));
+        std::fill(getRow(lastIndex), getRow(numberOfVertices), 0);
+        for (unsigned int row = 0; row < lastIndex; row++) {
+            eraseColumnFromRow(row, indexToRemove);
+        }
 
-    // Update the mappings
-    vertexToIndex.erase(vertex);
-    indexToVertex.erase(indexToRemove);
+        // Update the mappings
+        vertexToIndex.erase(vertex);
+        indexToVertex.erase(indexToVertex.begin() + indexToRemove);
 
-    // Adjust the remaining indices
-    for (unsigned int vertexIndex = indexToRemove; vertexIndex < numberOfVertices - 1; vertexIndex++) {
-        vertexToIndex[indexToVertex[vertexIndex + 1]]--;
-        indexToVertex[vertexIndex] = indexToVertex[vertexIndex + 1];
+        // Adjust the remaining indices
+        for (unsigned int vertexIndex = indexToRemove; vertexIndex < lastIndex; vertexIndex++) {
+            vertexToIndex[indexToVertex[vertexIndex]]--;
+        }
     }
-    indexToVertex.erase(numberOfVertices - 1);
 
     this->numberOfVertices--;
 }
@@ -130,18 +296,59 @@ void GraphViaAdjacentMatrix<GraphVertexType>::removeEdge(GraphVertexType sourceV
     unsigned int sourceIndex = vertexToIndex[sourceVertex];
     unsigned int destinationIndex = vertexToIndex[destinationVertex];
 
-    this->adjacentMatrix[sourceIndex][destinationIndex] = false;
+    setEdgeAt(sourceIndex, destinationIndex, false);
     this->numberOfEdges--;
     if (!isDirected) {
         // If the edge is undirected, remove the reverse edge
         // Note that removing edge is not removing the vertex
-        if (this->adjacentMatrix[destinationIndex][sourceIndex] == true) {
-            this->adjacentMatrix[destinationIndex][sourceIndex] = false;
+        if (hasEdgeAt(destinationIndex, sourceIndex)) {
+            setEdgeAt(destinationIndex, sourceIndex, false);
             this->numberOfEdges--;      // Considering the reverse edge
         }
     }
 }
 
+// Check whether there is an edge from the source vertex to the destination vertex
+template <typename GraphVertexType>
+bool GraphViaAdjacentMatrix<GraphVertexType>::hasEdge(const GraphVertexType& sourceVertex, const GraphVertexType& destinationVertex) const {
+    auto sourceIterator = vertexToIndex.find(sourceVertex);
+    auto destinationIterator = vertexToIndex.find(destinationVertex);
+    if (sourceIterator == vertexToIndex.end() || destinationIterator == vertexToIndex.end()) {
+        throw std::out_of_range("Invalid source or destination vertex");
+    }
+    return hasEdgeAt(sourceIterator->second, destinationIterator->second);
+}
+
+// Call visit(neighborIndex) for every outgoing neighbor of a vertex, in index order
+// Each word of the row is scanned by repeatedly taking its lowest set bit, so the empty parts of the row cost one check per 64 vertices.
+template <typename GraphVertexType>
+template <typename Visitor>
+void GraphViaAdjacentMatrix<GraphVertexType>::forEachNeighborIndex(unsigned int vertexIndex, Visitor visit) const {
+    const std::uint64_t* words = getRow(vertexIndex);
+    std::size_t usedWords = (this->numberOfVertices + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    for (std::size_t wordIndex = 0; wordIndex < usedWords; wordIndex++) {
+        std::uint64_t word = words[wordIndex];
+        while (word != 0) {
+            visit(static_cast<unsigned int>(wordIndex * BITS_PER_WORD + countTrailingZeros(word)));
+            word &= word - 1;   // Clear the lowest set bit
+        }
+    }
+}
+
+// Get the outgoing neighbors of a vertex, in index order
+template <typename GraphVertexType>
+std::vector<GraphVertexType> GraphViaAdjacentMatrix<GraphVertexType>::getNeighbors(const GraphVertexType& vertex) const {
+    auto vertexIterator = vertexToIndex.find(vertex);
+    if (vertexIterator == vertexToIndex.end()) {
+        throw std::out_of_range("Invalid vertex");
+    }
+    std::vector<GraphVertexType> neighbors;
+    forEachNeighborIndex(vertexIterator->second, [&](unsigned int neighborIndex) {
+        neighbors.push_back(indexToVertex[neighborIndex]);
+    });
+    return neighbors;
+}
+
 // Display the graph via adjacent matrix
 template <typename GraphVertexType>
 void GraphViaAdjacentMatrix<GraphVertexType>::displayGraph() {
@@ -153,12 +360,117 @@ void GraphViaAdjacentMatrix<GraphVertexType>::displayGraph() {
     for (unsigned int row = 0; row < numberOfVertices; row++) {
         std::cout << indexToVertex[row] << "  ";
         for (unsigned int column = 0; column < numberOfVertices; column++) {
-            std::cout << (this->adjacentMatrix[row][column] ? "T" : "F") << "  ";
+            std::cout << (hasEdgeAt(row, column) ? "T" : "F") << "  ";
         }
         std::cout << std::endl;
     }
 }
 
+// Count the triangles of an undirected graph (every edge added with isDirected = false)
+// For each edge (u, v) with u < v, the third vertices w > v are the common neighbors of u and v beyond v; so each triangle u < v < w is counted once.
+// It takes O(m * n / 64) word operations.
+template <typename GraphVertexType>
+std::uint64_t GraphViaAdjacentMatrix<GraphVertexType>::countTriangles() const {
+    std::size_t usedWords = (this->numberOfVertices + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    std::uint64_t numberOfTriangles = 0;
+    for (unsigned int vertex1 = 0; vertex1 < this->numberOfVertices; vertex1++) {
+        const std::uint64_t* row1 = getRow(vertex1);
+        forEachNeighborIndex(vertex1, [&](unsigned int vertex2) {
+            if (vertex2 <= vertex1)
+                return;
+            const std::uint64_t* row2 = getRow(vertex2);
+            // The word holding vertex2 only counts the bits above vertex2, the later words count whole
+            std::size_t wordIndex = vertex2 / BITS_PER_WORD;
+            std::uint64_t aboveMask = ~std::uint64_t(0) << (vertex2 % BITS_PER_WORD) << 1;
+            numberOfTriangles += countSetBits(row1[wordIndex] & row2[wordIndex] & aboveMask);
+            numberOfTriangles += countCommonBits(row1 + wordIndex + 1, row2 + wordIndex + 1, usedWords - wordIndex - 1);
+        });
+    }
+    return numberOfTriangles;
+}
+
+// Count the vertices both vertices have an edge to (e.g. the shared dependencies of two services)
+template <typename GraphVertexType>
+std::uint64_t GraphViaAdjacentMatrix<GraphVertexType>::countCommonNeighbors(const GraphVertexType& vertex1, const GraphVertexType& vertex2) const {
+    auto iterator1 = vertexToIndex.find(vertex1);
+    auto iterator2 = vertexToIndex.find(vertex2);
+    if (iterator1 == vertexToIndex.end() || iterator2 == vertexToIndex.end()) {
+        throw std::out_of_range("Invalid vertex");
+    }
+    std::size_t usedWords = (this->numberOfVertices + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    return countCommonBits(getRow(iterator1->second), getRow(iterator2->second), usedWords);
+}
+
+// Get the vertices reachable from a vertex in at most numberOfHops edges (not the vertex itself), in index order
+// A breadth-first search over bit sets; each hop ORs the rows of the frontier vertices, then drops the vertices reached before.
+template <typename GraphVertexType>
+std::vector<GraphVertexType> GraphViaAdjacentMatrix<GraphVertexType>::getVerticesWithinHops(const GraphVertexType& vertex, unsigned int numberOfHops) const {
+    auto vertexIterator = vertexToIndex.find(vertex);
+    if (vertexIterator == vertexToIndex.end()) {
+        throw std::out_of_range("Invalid vertex");
+    }
+    std::size_t usedWords = (this->numberOfVertices + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    std::vector<std::uint64_t> reached(usedWords, 0), frontier(usedWords, 0), nextFrontier(usedWords);
+    unsigned int startIndex = vertexIterator->second;
+    reached[startIndex / BITS_PER_WORD] |= std::uint64_t(1) << (startIndex % BITS_PER_WORD);
+    frontier[startIndex / BITS_PER_WORD] |= std::uint64_t(1) << (startIndex % BITS_PER_WORD);
+
+    for (unsigned int hop = 0; hop < numberOfHops; hop++) {
+        std::fill(nextFrontier.begin(), nextFrontier.end(), 0);
+        for (std::size_t wordIndex = 0; wordIndex < usedWords; wordIndex++) {
+            for (std::uint64_t word = frontier[wordIndex]; word != 0; word &= word - 1) {
+                const std::uint64_t* row = getRow(static_cast<unsigned int>(wordIndex * BITS_PER_WORD + countTrailingZeros(word)));
+                for (std::size_t index = 0; index < usedWords; index++) {
+                    nextFrontier[index] |= row[index];
+                }
+            }
+        }
+        bool isEmpty = true;
+        for (std::size_t index = 0; index < usedWords; index++) {
+            nextFrontier[index] &= ~reached[index];
+            reached[index] |= nextFrontier[index];
+            isEmpty = isEmpty && nextFrontier[index] == 0;
+        }
+        if (isEmpty)
+            break;
+        frontier.swap(nextFrontier);
+    }
+
+    std::vector<GraphVertexType> reachedVertices;
+    reached[startIndex / BITS_PER_WORD] &= ~(std::uint64_t(1) << (startIndex % BITS_PER_WORD));
+    for (std::size_t wordIndex = 0; wordIndex < usedWords; wordIndex++) {
+        for (std::uint64_t word = reached[wordIndex]; word != 0; word &= word - 1) {
+            reachedVertices.push_back(indexToVertex[wordIndex * BITS_PER_WORD + countTrailingZeros(word)]);
+        }
+    }
+    return reachedVertices;
+}
+
+// Compute the transitive closure (an edge u -> v whenever v is reachable from u) with Warshall's algorithm
+// For each intermediate vertex k, every row with an edge to k takes the OR of row k; O(n^3 / 64) word operations.
+template <typename GraphVertexType>
+GraphViaAdjacentMatrix<GraphVertexType> GraphViaAdjacentMatrix<GraphVertexType>::computeTransitiveClosure() const {
+    GraphViaAdjacentMatrix<GraphVertexType> closure(*this);
+    std::size_t usedWords = (this->numberOfVertices + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    for (unsigned int middle = 0; middle < closure.numberOfVertices; middle++) {
+        const std::uint64_t* middleRow = closure.getRow(middle);
+        for (unsigned int row = 0; row < closure.numberOfVertices; row++) {
+            if (row == middle || !closure.hasEdgeAt(row, middle))
+                continue;
+            std::uint64_t* words = closure.getRow(row);
+            for (std::size_t index = 0; index < usedWords; index++) {
+                words[index] |= middleRow[index];
+            }
+        }
+    }
+
+    closure.numberOfEdges = 0;
+    for (unsigned int row = 0; row < closure.numberOfVertices; row++) {
+        closure.numberOfEdges += static_cast<unsigned int>(countCommonBits(closure.getRow(row), closure.getRow(row), usedWords));
+    }
+    return closure;
+}
+
 int main(void) {
     GraphViaAdjacentMatrix<std::string> graph;
     graph.addVertex("A");
@@ -179,6 +491,64 @@ int main(void) {
 
     graph.displayGraph();
 
+    // Neighbors found by scanning the bits of a row
+    std::cout << std::endl << "Neighbors of F: ";
+    for (const std::string& neighbor : graph.getNeighbors("F")) {
+        std::cout << neighbor << " ";
+    }
+    std::cout << std::endl;
+
+    // Remove a vertex; the later rows and columns move up and left
+    graph.removeVertex("C");
+    std::cout << std::endl << "After removing C:" << std::endl;
+    graph.displayGraph();
+
+    // Remove a vertex by moving the last vertex into its place; the order changes, but only one row and one column move
+    graph.removeVertex("A", VertexRemovalMode::SwapWithLast);
+    std::cout << std::endl << "After removing A (swapped with the last vertex):" << std::endl;
+    graph.displayGraph();
+
+    // Triangles and common neighbors of an undirected graph
+    GraphViaAdjacentMatrix<std::string> undirectedGraph;
+    for (const char* vertex : {"A", "B", "C", "D", "E"}) {
+        undirectedGraph.addVertex(vertex);
+    }
+    undirectedGraph.addEdge("A", "B", false);
+    undirectedGraph.addEdge("B", "C", false);
+    undirectedGraph.addEdge("A", "C", false);
+    undirectedGraph.addEdge("C", "D", false);
+    undirectedGraph.addEdge("B", "D", false);
+    undirectedGraph.addEdge("D", "E", false);
+    std::cout << std::endl << "Triangles: " << undirectedGraph.countTriangles() << std::endl;
+    std::cout << "Common neighbors of A and D: " << undirectedGraph.countCommonNeighbors("A", "D") << std::endl;
+
+    // Reachability in a service dependency graph (an edge from a service to a service it calls)
+    GraphViaAdjacentMatrix<std::string> dependencyGraph;
+    for (const char* service : {"web", "api", "auth", "db", "queue"}) {
+        dependencyGraph.addVertex(service);
+    }
+    dependencyGraph.addEdge("web", "api", true);
+    dependencyGraph.addEdge("api", "auth", true);
+    dependencyGraph.addEdge("api", "queue", true);
+    dependencyGraph.addEdge("auth", "db", true);
+    dependencyGraph.addEdge("queue", "db", true);
+    for (unsigned int numberOfHops = 1; numberOfHops <= 3; numberOfHops++) {
+        std::cout << "Within " << numberOfHops << " hop(s) of web: ";
+        for (const std::string& service : dependencyGraph.getVerticesWithinHops("web", numberOfHops)) {
+            std::cout << service << " ";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl << "Transitive closure of the dependency graph:" << std::endl;
+    GraphViaAdjacentMatrix<std::string> closure = dependencyGraph.computeTransitiveClosure();
+    for (const char* service : {"web", "api", "auth", "db", "queue"}) {
+        std::cout << service << " -> ";
+        for (const std::string& dependency : closure.getNeighbors(service)) {
+            std::cout << dependency << " ";
+        }
+        std::cout << std::endl;
+    }
+
     return 0;
 }
 
@@ -188,4 +558,34 @@ int main(void) {
 // C  F  T  F  T  F  F
 // D  F  F  F  F  T  F
 // E  T  F  F  F  F  F
-// F  T  T  T  F  F  F
\ No newline at end of file
+// F  T  T  T  F  F  F
+//
+// Neighbors of F: A B C
+//
+// After removing C:
+//    A  B  D  E  F
+// A  F  T  F  T  F
+// B  F  F  F  F  T
+// D  F  F  F  T  F
+// E  T  F  F  F  F
+// F  T  T  F  F  F
+//
+// After removing A (swapped with the last vertex):
+//    F  B  D  E
+// F  F  T  F  F
+// B  T  F  F  F
+// D  F  F  F  T
+// E  F  F  F  F
+//
+// Triangles: 2
+// Common neighbors of A and D: 2
+// Within 1 hop(s) of web: api
+// Within 2 hop(s) of web: api auth queue
+// Within 3 hop(s) of web: api auth db queue
+//
+// Transitive closure of the dependency graph:
+// web -> api auth db queue
+// api -> auth db queue
+// auth -> db
+// db ->
+// queue -> db
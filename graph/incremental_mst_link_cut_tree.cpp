@@ -0,0 +1,318 @@
+/**
+ * @file incremental_mst_link_cut_tree.cpp
+ * @brief An incremental Minimum Spanning Tree (forest) maintained under edge insertions, with a link-cut tree, in C++ language
+ *        When an edge (u, v, w) is inserted;
+ *         - if u and v are not connected yet, the edge joins the MST.
+ *         - otherwise, the heaviest edge on the MST path between u and v is found; if it is heavier than w, it is replaced by the new edge.
+ *        (It is the cycle property; the heaviest edge of a cycle is never needed.)
+ *        The MST is kept in a link-cut tree (a forest of splay trees over the preferred paths), so the path maximum, link and cut
+ *        are all O(log V) amortized. So, each insertion costs O(log V) instead of rerunning Kruskal in O(E log E).
+ *        The edges of the MST are nodes of the link-cut tree as well (between their two endpoints), so the path maximum is an edge.
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include <random>
+#include "disjoint_set.hpp"
+#include "kruskal_mst.hpp"
+
+// An incremental MST under edge insertions
+class IncrementalMST {
+private:
+    static const int NIL = -1;
+
+    // The link-cut tree; nodes [0, numberOfVertices) are the vertices, and the rest are the MST edges
+    struct LinkCutNode {
+        int children[2];
+        int parent;
+        bool isReversed;        // The children (of the whole subtree) are to be swapped; pushed down lazily
+        double weight;          // The weight of an edge node (the lowest value for a vertex node, so it is never the maximum)
+        int maxNode;            // The node of the maximum weight in the splay subtree
+    };
+
+    // An MST edge (the endpoints of an edge node)
+    struct MSTEdge {
+        int source;
+        int destination;
+    };
+
+    std::vector<LinkCutNode> nodes;
+    std::vector<MSTEdge> mstEdgesOfNodes;       // mstEdgesOfNodes[node - numberOfVertices] for an edge node
+    std::vector<int> freeEdgeNodes;             // The edge nodes of the replaced edges, to be reused
+    DisjointSet connectivity;                   // The components only merge under insertions, so a disjoint set answers connectivity
+    std::vector<int> splayPath;                 // A buffer of splay, kept to avoid an allocation per splay
+    unsigned int numberOfVertices;
+    double totalWeight;
+
+    bool isSplayRoot(int node) const;
+    void pushDown(int node);
+    void update(int node);
+    void rotate(int node);
+    void splay(int node);
+    void access(int node);
+    void makeRoot(int node);
+    void link(int node1, int node2);
+    void cut(int node1, int node2);
+    int findPathMaximum(int node1, int node2);
+    int createEdgeNode(int source, int destination, double weight);
+
+public:
+    IncrementalMST(unsigned int numberOfVertices);
+
+    bool insertEdge(int source, int destination, double weight);    // Method to insert an edge, returning whether the MST has changed
+    double getTotalWeight() const { return this->totalWeight; }
+    std::vector<Edge> getMSTEdges() const;
+};
+
+// constructor
+IncrementalMST::IncrementalMST(unsigned int numberOfVertices) : connectivity(numberOfVertices) {
+    this->numberOfVertices = numberOfVertices;
+    this->totalWeight = 0;
+    this->nodes.reserve(2 * numberOfVertices);
+    for (unsigned int vertex = 0; vertex < numberOfVertices; vertex++) {
+        this->nodes.push_back(LinkCutNode{{NIL, NIL}, NIL, false, std::numeric_limits<double>::lowest(), static_cast<int>(vertex)});
+    }
+}
+
+// Helper method telling whether a node is the root of its splay tree (its parent pointer, if any, is a path-parent pointer)
+bool IncrementalMST::isSplayRoot(int node) const {
+    int parent = this->nodes[node].parent;
+    return parent == NIL || (this->nodes[parent].children[0] != node && this->nodes[parent].children[1] != node);
+}
+
+// Helper method to push the pending reversal of a node down to its children
+void IncrementalMST::pushDown(int node) {
+    LinkCutNode& current = this->nodes[node];
+    if (current.isReversed) {
+        std::swap(current.children[0], current.children[1]);
+        for (int child : current.children) {
+            if (child != NIL)
+                this->nodes[child].isReversed = !this->nodes[child].isReversed;
+        }
+        current.isReversed = false;
+    }
+}
+
+// Helper method to recompute the maximum of a node's splay subtree from its children
+void IncrementalMST::update(int node) {
+    LinkCutNode& current = this->nodes[node];
+    current.maxNode = node;
+    for (int child : current.children) {
+        if (child != NIL && this->nodes[this->nodes[child].maxNode].weight > this->nodes[current.maxNode].weight)
+            current.maxNode = this->nodes[child].maxNode;
+    }
+}
+
+// Helper method to rotate a node above its parent in the splay tree
+void IncrementalMST::rotate(int node) {
+    int parent = this->nodes[node].parent;
+    int grandparent = this->nodes[parent].parent;
+    int side = (this->nodes[parent].children[1] == node) ? 1 : 0;
+
+    if (!isSplayRoot(parent)) {
+        int parentSide = (this->nodes[grandparent].children[1] == parent) ? 1 : 0;
+        this->nodes[grandparent].children[parentSide] = node;
+    }
+    this->nodes[node].parent = grandparent;
+
+    int movedChild = this->nodes[node].children[1 - side];
+    this->nodes[parent].children[side] = movedChild;
+    if (movedChild != NIL)
+        this->nodes[movedChild].parent = parent;
+
+    this->nodes[node].children[1 - side] = parent;
+    this->nodes[parent].parent = node;
+
+    update(parent);
+    update(node);
+}
+
+// Helper method to splay a node to the root of its splay tree
+void IncrementalMST::splay(int node) {
+    // The pending reversals on the way from the splay root must be pushed down first, top to bottom
+    this->splayPath.assign(1, node);
+    for (int current = node; !isSplayRoot(current); current = this->nodes[current].parent) {
+        this->splayPath.push_back(this->nodes[current].parent);
+    }
+    for (auto ancestor = this->splayPath.rbegin(); ancestor != this->splayPath.rend(); ++ancestor) {
+        pushDown(*ancestor);
+    }
+
+    while (!isSplayRoot(node)) {
+        int parent = this->nodes[node].parent;
+        if (!isSplayRoot(parent)) {
+            int grandparent = this->nodes[parent].parent;
+            bool isZigZig = (this->nodes[grandparent].children[1] == parent) == (this->nodes[parent].children[1] == node);
+            rotate(isZigZig ? parent : node);
+        }
+        rotate(node);
+    }
+}
+
+// Helper method to make the path from the root of the represented tree to a node preferred, with the node at the splay root
+void IncrementalMST::access(int node) {
+    int last = NIL;
+    for (int current = node; current != NIL; current = this->nodes[current].parent) {
+        splay(current);
+        this->nodes[current].children[1] = last;
+        update(current);
+        last = current;
+    }
+    splay(node);
+}
+
+// Helper method to make a node the root of its represented tree (by reversing the path from the old root)
+void IncrementalMST::makeRoot(int node) {
+    access(node);
+    this->nodes[node].isReversed = !this->nodes[node].isReversed;
+}
+
+// Helper method to link two nodes of different trees
+void IncrementalMST::link(int node1, int node2) {
+    makeRoot(node1);
+    this->nodes[node1].parent = node2;
+}
+
+// Helper method to cut the link between two adjacent nodes
+void IncrementalMST::cut(int node1, int node2) {
+    makeRoot(node1);
+    access(node2);
+    // Now the path is node1 - node2, so node1 is the whole left subtree of node2
+    pushDown(node2);
+    this->nodes[node2].children[0] = NIL;
+    this->nodes[node1].parent = NIL;
+    update(node2);
+}
+
+// Helper method to find the edge node of the maximum weight on the path between two connected nodes
+int IncrementalMST::findPathMaximum(int node1, int node2) {
+    makeRoot(node1);
+    access(node2);
+    return this->nodes[node2].maxNode;
+}
+
+// Helper method to create (or reuse) an edge node
+int IncrementalMST::createEdgeNode(int source, int destination, double weight) {
+    int edgeNode;
+    if (!this->freeEdgeNodes.empty()) {
+        edgeNode = this->freeEdgeNodes.back();
+        this->freeEdgeNodes.pop_back();
+        this->mstEdgesOfNodes[edgeNode - this->numberOfVertices] = MSTEdge{source, destination};
+    } else {
+        edgeNode = static_cast<int>(this->nodes.size());
+        this->nodes.push_back(LinkCutNode());
+        this->mstEdgesOfNodes.push_back(MSTEdge{source, destination});
+    }
+    this->nodes[edgeNode] = LinkCutNode{{NIL, NIL}, NIL, false, weight, edgeNode};
+    return edgeNode;
+}
+
+// Method to insert an edge (1-based vertices, like KruskalMSTGraph::addEdge), returning whether the MST has changed
+bool IncrementalMST::insertEdge(int source, int destination, double weight) {
+    // Note that the vertices array is 0-based
+    source--;
+    destination--;
+    if (source < 0 || destination < 0 || source >= static_cast<int>(this->numberOfVertices) || destination >= static_cast<int>(this->numberOfVertices)) {
+        throw std::out_of_range("Invalid vertex");
+    }
+    if (source == destination)
+        return false;
+
+    // A new component pair; the edge simply joins the MST
+    if (this->connectivity.unite(source, destination)) {
+        int edgeNode = createEdgeNode(source, destination, weight);
+        link(source, edgeNode);
+        link(edgeNode, destination);
+        this->totalWeight += weight;
+        return true;
+    }
+
+    // Otherwise, replace the heaviest edge on the cycle if the new edge is lighter
+    int heaviestEdgeNode = findPathMaximum(source, destination);
+    double heaviestWeight = this->nodes[heaviestEdgeNode].weight;
+    if (!(weight < heaviestWeight))
+        return false;
+
+    const MSTEdge replacedEdge = this->mstEdgesOfNodes[heaviestEdgeNode - this->numberOfVertices];
+    cut(replacedEdge.source, heaviestEdgeNode);
+    cut(heaviestEdgeNode, replacedEdge.destination);
+    this->freeEdgeNodes.push_back(heaviestEdgeNode);
+    this->totalWeight -= heaviestWeight;
+
+    int edgeNode = createEdgeNode(source, destination, weight);
+    link(source, edgeNode);
+    link(edgeNode, destination);
+    this->totalWeight += weight;
+    return true;
+}
+
+// Method to get the current MST edges (0-based, like KruskalMSTGraph::findMST), in no particular order
+std::vector<Edge> IncrementalMST::getMSTEdges() const {
+    std::vector<bool> isFree(this->mstEdgesOfNodes.size(), false);
+    for (int edgeNode : this->freeEdgeNodes) {
+        isFree[edgeNode - this->numberOfVertices] = true;
+    }
+
+    std::vector<Edge> mstEdges;
+    for (std::size_t index = 0; index < this->mstEdgesOfNodes.size(); index++) {
+        if (!isFree[index]) {
+            const MSTEdge& mstEdge = this->mstEdgesOfNodes[index];
+            mstEdges.push_back(Edge(mstEdge.source, mstEdge.destination, this->nodes[this->numberOfVertices + index].weight));
+        }
+    }
+    return mstEdges;
+}
+
+int main(void) {
+    // The same graph as kruskal_mst.cpp, inserted edge by edge, and then a few lighter edges
+    IncrementalMST incrementalMST(4);    // A graph with 4 vertices
+    const std::vector<Edge> insertedEdges = {Edge(1, 2, 2), Edge(1, 3, 4), Edge(2, 3, 5), Edge(2, 4, 7), Edge(3, 4, 10), Edge(3, 4, 1), Edge(1, 4, 3)};
+    for (const Edge& edge : insertedEdges) {
+        bool isChanged = incrementalMST.insertEdge(edge.source, edge.destination, edge.weight);
+        std::cout << "Insert (" << edge.source << ", " << edge.destination << ") => Cost: " << edge.weight
+                  << (isChanged ? ", MST changed" : ", MST unchanged") << ", MST Weight: " << incrementalMST.getTotalWeight() << std::endl;
+    }
+
+    std::cout << "Following are the edges in the MST" << std::endl;
+    for (const Edge& edge : incrementalMST.getMSTEdges()) {
+        std::cout << "(" << edge.source + 1 << ", " << edge.destination + 1 << ") => Cost: " << edge.weight << std::endl;
+    }
+
+    // A random stream of 20000 edges over 1000 vertices, checked against Kruskal from scratch every 1000 insertions
+    std::mt19937 randomEngine(42);
+    IncrementalMST randomMST(1000);
+    KruskalMSTGraph kruskalGraph(1000);
+    bool isConsistent = true;
+    for (int index = 1; index <= 20000; index++) {
+        int source = 1 + static_cast<int>(randomEngine() % 1000), destination = 1 + static_cast<int>(randomEngine() % 1000);
+        double weight = static_cast<double>(randomEngine() % 100000);
+        randomMST.insertEdge(source, destination, weight);
+        kruskalGraph.addEdge(source, destination, weight);
+        if (index % 1000 == 0) {
+            double kruskalWeight = 0;
+            for (const Edge& edge : kruskalGraph.findMST()) {
+                kruskalWeight += edge.weight;
+            }
+            isConsistent = isConsistent && (kruskalWeight == randomMST.getTotalWeight());
+        }
+    }
+    std::cout << "Random insertions consistent with Kruskal: " << (isConsistent ? "Yes" : "No") << ", MST Weight: " << randomMST.getTotalWeight() << std::endl;
+
+    return 0;
+}
+
+// Insert (1, 2) => Cost: 2, MST changed, MST Weight: 2
+// Insert (1, 3) => Cost: 4, MST changed, MST Weight: 6
+// Insert (2, 3) => Cost: 5, MST unchanged, MST Weight: 6
+// Insert (2, 4) => Cost: 7, MST changed, MST Weight: 13
+// Insert (3, 4) => Cost: 10, MST unchanged, MST Weight: 13
+// Insert (3, 4) => Cost: 1, MST changed, MST Weight: 7
+// Insert (1, 4) => Cost: 3, MST changed, MST Weight: 6
+// Following are the edges in the MST
+// (1, 2) => Cost: 2
+// (1, 4) => Cost: 3
+// (3, 4) => Cost: 1
+// Random insertions consistent with Kruskal: Yes, MST Weight: 3.01904e+06
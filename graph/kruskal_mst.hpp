@@ -0,0 +1,301 @@
+/**
+ * @file kruskal_mst.hpp
+ * @brief Kruskal's Minimum Spanning Tree Algorithm implementation in C++ language
+ *        It is shared by kruskal_mst.cpp (example) and the other MST programs (e.g. mst_benchmark.cpp).
+ */
+
+#ifndef KRUSKAL_MST_HPP
+#define KRUSKAL_MST_HPP
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <functional>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "disjoint_set.hpp"
+#include "compressed_sparse_row_graph.hpp"
+
+// Define the structure for edges
+class Edge {
+public:
+    int source;
+    int destination;
+    double weight;
+
+    Edge(int source, int destination, double weight) {
+        this->source = source;
+        this->destination = destination;
+        this->weight = weight;
+    }
+};
+
+// The variants of Kruskal's Algorithm
+//  - Sort: every edge is sorted by weight, then scanned in that order.
+//  - FilterKruskal: the edges are partitioned around a pivot weight like quicksort; the light part is processed first,
+//                   then the heavy edges whose endpoints are already connected are filtered out before the heavy part is processed.
+//                   On dense graphs most heavy edges are filtered out and never sorted.
+enum class KruskalMode {
+    Sort,
+    FilterKruskal
+};
+
+// A graph class with Kruskal's MST algorithm
+// The edges are stored as a struct of arrays (edge i is (sources[i], destinations[i], weights[i])), and the algorithm only moves
+// 4-byte edge indices around; an Edge is only materialized for the MST edges returned.
+class KruskalMSTGraph {
+private:
+    std::vector<int> sources;
+    std::vector<int> destinations;
+    std::vector<double> weights;
+    unsigned int numberOfVertices;
+    unsigned int numThreads;
+
+    static constexpr unsigned int RADIX_BITS = 11;                                 // 6 passes over the 64-bit keys, 2048 buckets per pass
+    static constexpr std::ptrdiff_t COMPARISON_SORT_MAX_SIZE = 256;                // Smaller ranges are not worth the histograms
+    static constexpr std::ptrdiff_t PARALLEL_SORT_GRAIN_SIZE = 1 << 16;            // The smallest chunk handled by a thread of its own
+    static constexpr std::ptrdiff_t FILTER_KRUSKAL_BASE_CASE_SIZE = 1 << 16;       // Ranges up to max(this, V) are sorted instead of partitioned
+    static constexpr std::ptrdiff_t FILTER_BLOCK_SIZE = 256;                       // The number of heavy edges filtered per findMany
+
+    typedef std::vector<std::uint32_t>::iterator EdgeIndexIterator;
+
+    static std::uint64_t toSortableKey(double weight);
+    void sortEdgeIndicesByWeight(EdgeIndexIterator first, EdgeIndexIterator last) const;
+    void addSortedEdges(EdgeIndexIterator first, EdgeIndexIterator last, DisjointSet& disjointSet, std::vector<Edge>& mstEdges) const;
+    void filterKruskal(EdgeIndexIterator first, EdgeIndexIterator last, DisjointSet& disjointSet, std::vector<Edge>& mstEdges) const;
+
+public:
+    KruskalMSTGraph(unsigned int numberOfVertices, unsigned int numThreads = std::thread::hardware_concurrency()) {
+        this->numberOfVertices = numberOfVertices;
+        this->numThreads = (numThreads == 0) ? 1 : numThreads;
+    }
+
+    void reserve(std::size_t numberOfEdges);
+    void addEdge(int source, int destination, double weight);
+    void addEdges(const CsrGraph<double>& graph);
+    std::vector<Edge> findMST(KruskalMode mode = KruskalMode::Sort) const;
+};
+
+// Function to preallocate the edge arrays
+inline void KruskalMSTGraph::reserve(std::size_t numberOfEdges) {
+    this->sources.reserve(numberOfEdges);
+    this->destinations.reserve(numberOfEdges);
+    this->weights.reserve(numberOfEdges);
+}
+
+// Function to add an edge to the graph
+inline void KruskalMSTGraph::addEdge(int source, int destination, double weight) {
+    if (this->weights.size() == UINT32_MAX) {
+        throw std::length_error("Too many edges for 32-bit edge indices");
+    }
+    // Note that the vertices array is 0-based
+    this->sources.push_back(source - 1);
+    this->destinations.push_back(destination - 1);
+    this->weights.push_back(weight);
+}
+
+// Function to add the edges of an undirected CSR graph (each edge stored in both directions, with 0-based vertex IDs)
+// Only the direction with source < destination is taken, so every edge is added once.
+inline void KruskalMSTGraph::addEdges(const CsrGraph<double>& graph) {
+    if (graph.getNumberOfVertices() > this->numberOfVertices) {
+        throw std::out_of_range("The CSR graph has more vertices than the MST graph");
+    }
+    for (std::uint32_t source = 0; source < graph.getNumberOfVertices(); source++) {
+        for (std::uint32_t edgeIndex = graph.offsets[source]; edgeIndex < graph.offsets[source + 1]; edgeIndex++) {
+            if (source < graph.targets[edgeIndex]) {
+                addEdge(static_cast<int>(source) + 1, static_cast<int>(graph.targets[edgeIndex]) + 1, graph.weights[edgeIndex]);
+            }
+        }
+    }
+}
+
+// Helper method to map a weight to an unsigned integer of the same order
+// A non-negative double keeps its bits with the sign bit set, and a negative one has all its bits flipped (so a larger magnitude is smaller).
+// -0.0 is mapped as 0.0, since they compare equal.
+inline std::uint64_t KruskalMSTGraph::toSortableKey(double weight) {
+    if (weight == 0)
+        weight = 0;
+    std::uint64_t bits;
+    std::memcpy(&bits, &weight, sizeof(bits));
+    return (bits >> 63) ? ~bits : (bits | (std::uint64_t(1) << 63));
+}
+
+// Helper method to sort a range of edge indices by the weights in non-decreasing order, with an LSD radix sort over the sortable keys
+// Radix sort is stable, so the edges of the same weight keep their relative order and the MST is unique for a given edge list
+// (and it is the same one that the other MST algorithms breaking ties by the insertion order find, e.g. boruvka_mst.hpp).
+// Each pass builds a histogram per chunk in parallel, then scatters every chunk in parallel into its own slots of each bucket;
+// a pass whose digit is the same for every key (e.g. the low mantissa bits of integral weights) is skipped.
+inline void KruskalMSTGraph::sortEdgeIndicesByWeight(EdgeIndexIterator first, EdgeIndexIterator last) const {
+    const std::ptrdiff_t count = last - first;
+    if (count <= COMPARISON_SORT_MAX_SIZE) {
+        std::stable_sort(first, last, [this](std::uint32_t edgeIndex1, std::uint32_t edgeIndex2) {
+            return this->weights[edgeIndex1] < this->weights[edgeIndex2];
+        });
+        return;
+    }
+
+    const std::size_t NUM_BUCKETS = std::size_t(1) << RADIX_BITS;
+    const std::ptrdiff_t numChunks = std::min<std::ptrdiff_t>(this->numThreads, std::max<std::ptrdiff_t>(count / PARALLEL_SORT_GRAIN_SIZE, 1));
+    auto runChunks = [numChunks](const std::function<void(std::ptrdiff_t)>& body) {
+        std::vector<std::thread> threads;
+        for (std::ptrdiff_t chunkIndex = 1; chunkIndex < numChunks; chunkIndex++) {
+            threads.emplace_back(body, chunkIndex);
+        }
+        body(0);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    };
+    auto chunkBegin = [count, numChunks](std::ptrdiff_t chunkIndex) { return count * chunkIndex / numChunks; };
+
+    // The (key, edge index) pairs are sorted together, so a pass never reads the weights at random
+    std::vector<std::uint64_t> keys(count), keysBuffer(count);
+    std::vector<std::uint32_t> edgeIndices(first, last), edgeIndicesBuffer(count);
+    runChunks([&](std::ptrdiff_t chunkIndex) {
+        const std::ptrdiff_t chunkEnd = chunkBegin(chunkIndex + 1);
+        for (std::ptrdiff_t index = chunkBegin(chunkIndex); index < chunkEnd; index++) {
+            keys[index] = toSortableKey(this->weights[edgeIndices[index]]);
+        }
+    });
+
+    std::vector<std::vector<std::size_t>> bucketOffsets(numChunks, std::vector<std::size_t>(NUM_BUCKETS));
+    for (unsigned int shift = 0; shift < 64; shift += RADIX_BITS) {
+        runChunks([&](std::ptrdiff_t chunkIndex) {
+            std::vector<std::size_t>& histogram = bucketOffsets[chunkIndex];
+            std::fill(histogram.begin(), histogram.end(), 0);
+            const std::ptrdiff_t chunkEnd = chunkBegin(chunkIndex + 1);
+            for (std::ptrdiff_t index = chunkBegin(chunkIndex); index < chunkEnd; index++) {
+                histogram[(keys[index] >> shift) & (NUM_BUCKETS - 1)]++;
+            }
+        });
+
+        // Turn the histograms into the starting offsets; bucket by bucket, then chunk by chunk within a bucket (for the stability)
+        std::size_t offset = 0;
+        bool isSingleBucket = false;
+        for (std::size_t bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+            std::size_t bucketSize = 0;
+            for (std::ptrdiff_t chunkIndex = 0; chunkIndex < numChunks; chunkIndex++) {
+                std::size_t chunkCount = bucketOffsets[chunkIndex][bucket];
+                bucketOffsets[chunkIndex][bucket] = offset;
+                offset += chunkCount;
+                bucketSize += chunkCount;
+            }
+            isSingleBucket |= (bucketSize == static_cast<std::size_t>(count));
+        }
+        if (isSingleBucket)
+            continue;
+
+        runChunks([&](std::ptrdiff_t chunkIndex) {
+            std::vector<std::size_t>& nextSlots = bucketOffsets[chunkIndex];
+            const std::ptrdiff_t chunkEnd = chunkBegin(chunkIndex + 1);
+            for (std::ptrdiff_t index = chunkBegin(chunkIndex); index < chunkEnd; index++) {
+                std::size_t slot = nextSlots[(keys[index] >> shift) & (NUM_BUCKETS - 1)]++;
+                keysBuffer[slot] = keys[index];
+                edgeIndicesBuffer[slot] = edgeIndices[index];
+            }
+        });
+        keys.swap(keysBuffer);
+        edgeIndices.swap(edgeIndicesBuffer);
+    }
+
+    std::copy(edgeIndices.begin(), edgeIndices.end(), first);
+}
+
+// Helper method to scan a range of edge indices sorted by weight, adding the edges connecting two components to the MST
+inline void KruskalMSTGraph::addSortedEdges(EdgeIndexIterator first, EdgeIndexIterator last, DisjointSet& disjointSet, std::vector<Edge>& mstEdges) const {
+    for (EdgeIndexIterator edgeIndex = first; edgeIndex != last && mstEdges.size() + 1 < this->numberOfVertices; ++edgeIndex) {
+        int parentOfSourceVertex = disjointSet.findParentVertex(this->sources[*edgeIndex]);
+        int parentOfDestinationVertex = disjointSet.findParentVertex(this->destinations[*edgeIndex]);
+
+        if (parentOfSourceVertex != parentOfDestinationVertex) {
+            // If the parent of source vertex is not equal to the parent of destination vertex,
+            // then unite (union) the two sets and add the edge to the minimum spanning tree
+            disjointSet.unite(parentOfSourceVertex, parentOfDestinationVertex);
+            mstEdges.push_back(Edge(this->sources[*edgeIndex], this->destinations[*edgeIndex], this->weights[*edgeIndex]));
+        }
+    }
+}
+
+// Helper method of Filter-Kruskal over a range of edge indices
+// The range is split into (lighter than the pivot | as heavy as the pivot | heavier than the pivot) by stable partitions,
+// so that the edges of the same weight keep their relative order, just like sortEdgeIndicesByWeight.
+inline void KruskalMSTGraph::filterKruskal(EdgeIndexIterator first, EdgeIndexIterator last, DisjointSet& disjointSet, std::vector<Edge>& mstEdges) const {
+    if (mstEdges.size() + 1 >= this->numberOfVertices)
+        return;
+    if (last - first <= std::max<std::ptrdiff_t>(FILTER_KRUSKAL_BASE_CASE_SIZE, this->numberOfVertices)) {
+        sortEdgeIndicesByWeight(first, last);
+        addSortedEdges(first, last, disjointSet, mstEdges);
+        return;
+    }
+
+    // The pivot is the median weight of the first, middle and last edges
+    double pivotWeights[3] = {this->weights[*first], this->weights[first[(last - first) / 2]], this->weights[*(last - 1)]};
+    std::sort(pivotWeights, pivotWeights + 3);
+    const double pivotWeight = pivotWeights[1];
+
+    EdgeIndexIterator lightEnd = std::stable_partition(first, last, [this, pivotWeight](std::uint32_t edgeIndex) {
+        return this->weights[edgeIndex] < pivotWeight;
+    });
+    EdgeIndexIterator pivotEnd = std::stable_partition(lightEnd, last, [this, pivotWeight](std::uint32_t edgeIndex) {
+        return this->weights[edgeIndex] == pivotWeight;
+    });
+
+    // The light part first, then the edges of the pivot weight (already in order)
+    filterKruskal(first, lightEnd, disjointSet, mstEdges);
+    addSortedEdges(lightEnd, pivotEnd, disjointSet, mstEdges);
+
+    // Filter out the heavy edges whose endpoints are already connected; they can never be in the MST
+    // The endpoints are looked up by blocks with DisjointSet::findMany, so the cache misses of the finds overlap.
+    EdgeIndexIterator heavyEnd = pivotEnd;
+    int blockVertices[2 * FILTER_BLOCK_SIZE], blockRoots[2 * FILTER_BLOCK_SIZE];
+    for (EdgeIndexIterator blockBegin = pivotEnd; blockBegin != last; ) {
+        const std::ptrdiff_t blockSize = std::min<std::ptrdiff_t>(FILTER_BLOCK_SIZE, last - blockBegin);
+        for (std::ptrdiff_t index = 0; index < blockSize; index++) {
+            blockVertices[2 * index] = this->sources[blockBegin[index]];
+            blockVertices[2 * index + 1] = this->destinations[blockBegin[index]];
+        }
+        disjointSet.findMany(blockVertices, 2 * blockSize, blockRoots);
+        for (std::ptrdiff_t index = 0; index < blockSize; index++) {
+            if (blockRoots[2 * index] != blockRoots[2 * index + 1]) {
+                *heavyEnd++ = blockBegin[index];
+            }
+        }
+        blockBegin += blockSize;
+    }
+    filterKruskal(pivotEnd, heavyEnd, disjointSet, mstEdges);
+}
+
+// Kruskal's Algorithm to find the Minimum Spanning Tree
+// The MST edges are returned in the order they are added (the non-decreasing order of weights).
+inline std::vector<Edge> KruskalMSTGraph::findMST(KruskalMode mode) const {
+    // Create a disjoint set
+    DisjointSet disjointSet(this->numberOfVertices);
+    std::vector<Edge> mstEdges;
+
+    // The permutation of the edges to walk; the edge arrays themselves are never reordered
+    std::vector<std::uint32_t> edgeIndices(this->weights.size());
+    for (std::size_t index = 0; index < edgeIndices.size(); index++) {
+        edgeIndices[index] = static_cast<std::uint32_t>(index);
+    }
+
+    if (mode == KruskalMode::FilterKruskal) {
+        filterKruskal(edgeIndices.begin(), edgeIndices.end(), disjointSet, mstEdges);
+        return mstEdges;
+    }
+
+    // Sort the edges based on their weights in non-decreasing order, then add them one by one
+    sortEdgeIndicesByWeight(edgeIndices.begin(), edgeIndices.end());
+    addSortedEdges(edgeIndices.begin(), edgeIndices.end(), disjointSet, mstEdges);
+
+    return mstEdges;
+}
+
+constexpr unsigned int KruskalMSTGraph::RADIX_BITS;
+constexpr std::ptrdiff_t KruskalMSTGraph::COMPARISON_SORT_MAX_SIZE;
+constexpr std::ptrdiff_t KruskalMSTGraph::PARALLEL_SORT_GRAIN_SIZE;
+constexpr std::ptrdiff_t KruskalMSTGraph::FILTER_KRUSKAL_BASE_CASE_SIZE;
+constexpr std::ptrdiff_t KruskalMSTGraph::FILTER_BLOCK_SIZE;
+
+#endif // KRUSKAL_MST_HPP
@@ -0,0 +1,230 @@
+/**
+ * @file mst_benchmark.cpp
+ * @brief A benchmark comparing the MST algorithms of this directory on random connected graphs
+ *        (KruskalMSTGraph of kruskal_mst.hpp in both modes, primMST of prim_mst_via_priority_queue.hpp in both modes, BoruvkaMSTGraph of boruvka_mst.hpp)
+ *        Every result is checked against Kruskal's; the total weight must match, and for Borůvka (which breaks ties the same way)
+ *        the edge set must match as well.
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread mst_benchmark.cpp -o mst_benchmark
+ *                     ./mst_benchmark [--vertices V --edges E] [--threads T] [--format csv|json]
+ */
+
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+#include <tuple>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include "kruskal_mst.hpp"
+#include "prim_mst_via_priority_queue.hpp"
+#include "boruvka_mst.hpp"
+
+// A random connected graph; a random spanning path keeps it connected, and the rest of the edges are uniformly random
+// The weights are small integers, so there are many ties (which the algorithms must break consistently).
+struct RandomGraph {
+    std::string name;
+    unsigned int numberOfVertices;
+    std::vector<std::tuple<unsigned int, unsigned int, double>> edges;     // 0-based (source, destination, weight)
+};
+
+// The measured result of a single algorithm over a single graph
+struct BenchmarkResult {
+    std::string graphName;
+    std::string algorithmName;
+    unsigned int numberOfVertices;
+    std::size_t numberOfEdges;
+    std::size_t mstEdges;
+    double mstWeight;
+    double runtimeMilliseconds;
+    bool sameWeight;        // The total weight is the same as Kruskal's
+    bool sameEdges;         // The edge set is the same as Kruskal's
+};
+
+// Generate a random connected graph; the seed is fixed so that the graphs are the same across runs (and commits)
+RandomGraph generateRandomGraph(unsigned int numberOfVertices, std::size_t numberOfEdges) {
+    std::mt19937_64 randomEngine(20240601);
+    std::uniform_int_distribution<unsigned int> vertexDistribution(0, numberOfVertices - 1);
+    std::uniform_int_distribution<unsigned int> weightDistribution(1, 1000);
+
+    RandomGraph graph;
+    graph.name = "random-v" + std::to_string(numberOfVertices) + "-e" + std::to_string(numberOfEdges);
+    graph.numberOfVertices = numberOfVertices;
+    graph.edges.reserve(numberOfEdges);
+
+    std::vector<unsigned int> path(numberOfVertices);
+    for (unsigned int vertex = 0; vertex < numberOfVertices; vertex++) {
+        path[vertex] = vertex;
+    }
+    std::shuffle(path.begin(), path.end(), randomEngine);
+    for (unsigned int index = 1; index < numberOfVertices && graph.edges.size() < numberOfEdges; index++) {
+        graph.edges.emplace_back(path[index - 1], path[index], weightDistribution(randomEngine));
+    }
+    while (graph.edges.size() < numberOfEdges) {
+        graph.edges.emplace_back(vertexDistribution(randomEngine), vertexDistribution(randomEngine), weightDistribution(randomEngine));
+    }
+    return graph;
+}
+
+// Normalize MST edges into sorted (smaller endpoint, larger endpoint, weight) triples to compare edge sets
+std::vector<std::tuple<unsigned int, unsigned int, double>> normalizeEdges(const std::vector<std::tuple<unsigned int, unsigned int, double>>& edges) {
+    std::vector<std::tuple<unsigned int, unsigned int, double>> normalizedEdges;
+    normalizedEdges.reserve(edges.size());
+    for (const auto& edge : edges) {
+        unsigned int source = std::get<0>(edge), destination = std::get<1>(edge);
+        normalizedEdges.emplace_back(std::min(source, destination), std::max(source, destination), std::get<2>(edge));
+    }
+    std::sort(normalizedEdges.begin(), normalizedEdges.end());
+    return normalizedEdges;
+}
+
+// Convert the MST edges of Kruskal and Borůvka (0-based Edge) into triples
+std::vector<std::tuple<unsigned int, unsigned int, double>> toTriples(const std::vector<Edge>& edges) {
+    std::vector<std::tuple<unsigned int, unsigned int, double>> triples;
+    for (const Edge& edge : edges) {
+        triples.emplace_back(edge.source, edge.destination, edge.weight);
+    }
+    return triples;
+}
+
+// Run every algorithm over a graph
+std::vector<BenchmarkResult> benchmarkGraph(const RandomGraph& graph, unsigned int numThreads) {
+    // Build the input of each algorithm beforehand; only the MST computation is measured
+    KruskalMSTGraph kruskalGraph(graph.numberOfVertices, numThreads);
+    BoruvkaMSTGraph boruvkaGraph(graph.numberOfVertices, numThreads);
+    std::vector<WeightedEdge<double>> csrEdges;
+    csrEdges.reserve(2 * graph.edges.size());
+    for (const auto& edge : graph.edges) {
+        kruskalGraph.addEdge(std::get<0>(edge) + 1, std::get<1>(edge) + 1, std::get<2>(edge));
+        boruvkaGraph.addEdge(std::get<0>(edge) + 1, std::get<1>(edge) + 1, std::get<2>(edge));
+        csrEdges.push_back(WeightedEdge<double>{std::get<0>(edge), std::get<1>(edge), std::get<2>(edge)});
+        csrEdges.push_back(WeightedEdge<double>{std::get<1>(edge), std::get<0>(edge), std::get<2>(edge)});
+    }
+    CsrGraph<double> csrGraph = buildCsrGraph(graph.numberOfVertices, csrEdges);
+    csrEdges.clear();
+    csrEdges.shrink_to_fit();
+
+    std::vector<std::pair<std::string, std::vector<std::tuple<unsigned int, unsigned int, double>>>> mstResults;
+    std::vector<double> runtimes;
+    auto measure = [&](const std::string& algorithmName, const std::function<std::vector<std::tuple<unsigned int, unsigned int, double>>()>& algorithm) {
+        auto startTime = std::chrono::steady_clock::now();
+        std::vector<std::tuple<unsigned int, unsigned int, double>> mstEdges = algorithm();
+        auto endTime = std::chrono::steady_clock::now();
+        mstResults.emplace_back(algorithmName, normalizeEdges(mstEdges));
+        runtimes.push_back(std::chrono::duration<double, std::milli>(endTime - startTime).count());
+    };
+
+    measure("kruskal", [&]() { return toTriples(kruskalGraph.findMST(KruskalMode::Sort)); });
+    measure("kruskal-filter", [&]() { return toTriples(kruskalGraph.findMST(KruskalMode::FilterKruskal)); });
+    for (PrimMode mode : {PrimMode::Lazy, PrimMode::Eager}) {
+        measure(mode == PrimMode::Lazy ? "prim-lazy" : "prim-eager", [&]() {
+            std::vector<std::tuple<unsigned int, unsigned int, double>> triples;
+            for (const WeightedEdge<double>& edge : primMST(csrGraph, 0, mode)) {
+                triples.emplace_back(edge.source, edge.destination, edge.weight);
+            }
+            return triples;
+        });
+    }
+    measure("boruvka", [&]() { return toTriples(boruvkaGraph.findMST()); });
+
+    std::vector<BenchmarkResult> results;
+    for (std::size_t index = 0; index < mstResults.size(); index++) {
+        BenchmarkResult result;
+        result.graphName = graph.name;
+        result.algorithmName = mstResults[index].first;
+        result.numberOfVertices = graph.numberOfVertices;
+        result.numberOfEdges = graph.edges.size();
+        result.mstEdges = mstResults[index].second.size();
+        result.mstWeight = 0;
+        for (const auto& edge : mstResults[index].second) {
+            result.mstWeight += std::get<2>(edge);
+        }
+        result.runtimeMilliseconds = runtimes[index];
+        result.sameWeight = (index == 0) || result.mstWeight == results[0].mstWeight;
+        result.sameEdges = (mstResults[index].second == mstResults[0].second);
+        results.push_back(result);
+    }
+    return results;
+}
+
+int main(int argc, char* argv[]) {
+    std::string outputFormat = "csv";
+    unsigned int numberOfVertices = 0;
+    std::size_t numberOfEdges = 0;
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    for (int index = 1; index < argc; index++) {
+        std::string argument = argv[index];
+        if (argument == "--vertices" && index + 1 < argc) {
+            numberOfVertices = static_cast<unsigned int>(std::strtoul(argv[++index], nullptr, 10));
+        } else if (argument == "--edges" && index + 1 < argc) {
+            numberOfEdges = static_cast<std::size_t>(std::strtoull(argv[++index], nullptr, 10));
+        } else if (argument == "--threads" && index + 1 < argc) {
+            numThreads = static_cast<unsigned int>(std::strtoul(argv[++index], nullptr, 10));
+        } else if (argument == "--format" && index + 1 < argc) {
+            outputFormat = argv[++index];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--vertices V --edges E] [--threads T] [--format csv|json]" << std::endl;
+            return 1;
+        }
+    }
+    if ((outputFormat != "csv" && outputFormat != "json") || (numberOfVertices == 0) != (numberOfEdges == 0)) {
+        std::cerr << "The format must be csv or json, and --vertices and --edges must be given together" << std::endl;
+        return 1;
+    }
+    if (numberOfEdges > UINT32_MAX) {
+        std::cerr << "At most " << UINT32_MAX << " edges are supported" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::pair<unsigned int, std::size_t>> graphSizes = {{10000, 100000}, {100000, 1000000}, {1000000, 10000000}};
+    if (numberOfVertices != 0) {
+        graphSizes = {{numberOfVertices, numberOfEdges}};
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& graphSize : graphSizes) {
+        std::vector<BenchmarkResult> graphResults = benchmarkGraph(generateRandomGraph(graphSize.first, graphSize.second), numThreads);
+        results.insert(results.end(), graphResults.begin(), graphResults.end());
+    }
+
+    if (outputFormat == "csv") {
+        std::cout << "graph,algorithm,vertices,edges,mst_edges,mst_weight,runtime_ms,same_weight,same_edges" << std::endl;
+        for (const BenchmarkResult& result : results) {
+            std::cout << result.graphName << ',' << result.algorithmName << ',' << result.numberOfVertices << ',' << result.numberOfEdges << ','
+                      << result.mstEdges << ',' << static_cast<unsigned long long>(result.mstWeight) << ',' << result.runtimeMilliseconds << ','
+                      << (result.sameWeight ? "true" : "false") << ',' << (result.sameEdges ? "true" : "false") << std::endl;
+        }
+    } else {
+        std::cout << "[" << std::endl;
+        for (std::size_t index = 0; index < results.size(); index++) {
+            const BenchmarkResult& result = results[index];
+            std::cout << "  {\"graph\": \"" << result.graphName << "\", \"algorithm\": \"" << result.algorithmName << "\""
+                      << ", \"vertices\": " << result.numberOfVertices << ", \"edges\": " << result.numberOfEdges
+                      << ", \"mst_edges\": " << result.mstEdges << ", \"mst_weight\": " << static_cast<unsigned long long>(result.mstWeight)
+                      << ", \"runtime_ms\": " << result.runtimeMilliseconds << ", \"same_weight\": " << (result.sameWeight ? "true" : "false")
+                      << ", \"same_edges\": " << (result.sameEdges ? "true" : "false") << "}" << (index + 1 < results.size() ? "," : "") << std::endl;
+        }
+        std::cout << "]" << std::endl;
+    }
+
+    return 0;
+}
+
+// $ ./mst_benchmark --threads 1
+// graph,algorithm,vertices,edges,mst_edges,mst_weight,runtime_ms,same_weight,same_edges
+// random-v10000-e100000,kruskal,10000,100000,9999,600619,5.95527,true,true
+// random-v10000-e100000,kruskal-filter,10000,100000,9999,600619,2.97413,true,true
+// random-v10000-e100000,prim-lazy,10000,100000,9999,600619,14.2168,true,false
+// random-v10000-e100000,prim-eager,10000,100000,9999,600619,5.49252,true,false
+// random-v10000-e100000,boruvka,10000,100000,9999,600619,11.7967,true,true
+// ...
+// random-v1000000-e10000000,kruskal,1000000,10000000,999999,60489385,1158.2,true,true
+// random-v1000000-e10000000,kruskal-filter,1000000,10000000,999999,60489385,726.666,true,true
+// random-v1000000-e10000000,prim-lazy,1000000,10000000,999999,60489385,3791.75,true,false
+// random-v1000000-e10000000,prim-eager,1000000,10000000,999999,60489385,2143.83,true,false
+// random-v1000000-e10000000,boruvka,1000000,10000000,999999,60489385,5287.9,true,true
+// (The runtimes vary by machine and thread count; the MSTs are deterministic)
+// (Prim breaks ties between equal weights differently, so its edge set may differ while the total weight is the same)
@@ -1,84 +1,36 @@
 /**
  * @file prim_mst_via_priority_queue.cpp
  * @brief Prim's Minimum Spanning Tree Algorithm using Priority Queue (Adjacency List) built with using C++.
+ *        Besides the string-keyed adjacency list, a compressed sparse row (CSR) graph over dense uint32 vertex IDs is supported.
+ *        The string-keyed version is a front end interning the vertex names into the IDs, then running the CSR version.
  */
 //
 
 #include <iostream>
 #include <vector>
-#include <queue>
 #include <tuple>
 #include <unordered_map>
 #include <string>
+#include "prim_mst_via_priority_queue.hpp"
 
-// Define a custom comparator for priority queue
-struct Compare {
-    bool operator()(const std::tuple<double, std::string, std::string>& edge1,
-                    const std::tuple<double, std::string, std::string>& edge2) {
-        // Compare the weights of the edges and return if the weight of the first edge is greater than the second's
-        return std::get<0>(edge1) > std::get<0>(edge2);
-    }
-};
-
-// Function to find the Minimum Spanning Tree using Prim's Algorithm
-// The graph is represented as <startingVertex, <destinationVertex, weight>>
-template <typename EdgeWeightType>      // WeightType is the type of the weight of the edge (int, double, float, etc.)
-void primMST(const std::unordered_map<std::string, std::vector<std::pair<std::string, EdgeWeightType>>>& graphAdjacencyList,
-             const std::string& startingVertex) {
-
-    // Priority queue to store the edges
-    std::priority_queue<std::tuple<EdgeWeightType, std::string, std::string>, 
-                        std::vector<std::tuple<EdgeWeightType, std::string, std::string>>, 
-                        Compare> priorityQueue;
-
-    // Track the visited vertices for MST
-    std::unordered_map<std::string, bool> visitedVertices;
-
-    // Store the weights of the MST edges
-    std::vector<std::tuple<std::string, std::string, EdgeWeightType>> mstEdges;
-
-    // Total weight of the MST
+// A helper method to print the MST edges and the total weight
+template <typename EdgeWeightType>
+void displayMST(const std::vector<std::tuple<std::string, std::string, EdgeWeightType>>& mstEdges) {
     EdgeWeightType mstTotalWeight = 0;
-
-    // Initialize the starting vertex and its adjacencies
-    visitedVertices[startingVertex] = true;
-    for (const auto& neighbour : graphAdjacencyList.at(startingVertex)) {
-        // (weight, startingVertex, destinationVertex)
-        priorityQueue.push({neighbour.second, startingVertex, neighbour.first});
-    }
-
-    // Loop until the priority queue is empty
-    while (!priorityQueue.empty()) {
-        EdgeWeightType edgeWeight;
-        std::string startingVertex, destinationVertex;
-        std::tie(edgeWeight, startingVertex, destinationVertex) = priorityQueue.top();
-        priorityQueue.pop();
-
-        // If the destination vertex is already visited, skip the edge
-        if (visitedVertices[destinationVertex])
-            continue;
-
-        // Include the edge in the MST
-        visitedVertices[destinationVertex] = true;
-        mstEdges.push_back(std::make_tuple(startingVertex, destinationVertex, edgeWeight));
-        mstTotalWeight += edgeWeight;
-
-        // Add the destination vertex's adjacencies to the priority queue
-        for (const auto& destinationVertexNeighbour : graphAdjacencyList.at(destinationVertex)) {
-            if (!visitedVertices[destinationVertexNeighbour.first]) {
-                priorityQueue.push({destinationVertexNeighbour.second, destinationVertex, destinationVertexNeighbour.first});
-            }
-        }
-    }
-
-    // Print
     std::cout << "Minimum Spanning Tree Edges:\n";
     for (const auto& edge : mstEdges) {
         std::cout << "(" << std::get<0>(edge) << ", " << std::get<1>(edge) << ") -> Cost: " << std::get<2>(edge) << "\n";
+        mstTotalWeight += std::get<2>(edge);
     }
     std::cout << "Total Weight of MST: " << mstTotalWeight << "\n";
 }
 
+// A helper method to print the heap statistics of a run
+void displayPrimStatistics(const std::string& modeName, const PrimStatistics& statistics) {
+    std::cout << modeName << ": peak heap size " << statistics.peakHeapSize << ", pushes " << statistics.heapPushes
+              << ", pops " << statistics.heapPops << " (stale " << statistics.stalePops << "), decrease-keys " << statistics.decreaseKeys << "\n";
+}
+
 int main(void) {
     std::unordered_map<std::string, std::vector<std::pair<std::string, int>>> graph{
         {"A", {{"B", 2}, {"D", 6}}},
@@ -88,13 +40,42 @@ int main(void) {
         {"E", {{"B", 5}, {"C", 7}, {"D", 9}}}
     };
     
-    primMST(graph, "A");
+    PrimStatistics lazyStatistics, eagerStatistics;
+    displayMST(primMST(graph, "A", PrimMode::Lazy, &lazyStatistics));
+    displayMST(primMST(graph, "A", PrimMode::Eager, &eagerStatistics));
+    displayPrimStatistics("Lazy", lazyStatistics);
+    displayPrimStatistics("Eager", eagerStatistics);
+
+    // A complete graph of 8 vertices (with the weight |i - j| * (i + j)), where the lazy heap holds most of the edges
+    std::vector<WeightedEdge<int>> completeGraphEdges;
+    for (std::uint32_t i = 0; i < 8; i++) {
+        for (std::uint32_t j = 0; j < 8; j++) {
+            if (i != j)
+                completeGraphEdges.push_back(WeightedEdge<int>{i, j, static_cast<int>((i > j ? i - j : j - i) * (i + j))});
+        }
+    }
+    CsrGraph<int> completeGraph = buildCsrGraph(8, completeGraphEdges);
+    primMST(completeGraph, 0, PrimMode::Lazy, &lazyStatistics);
+    primMST(completeGraph, 0, PrimMode::Eager, &eagerStatistics);
+    displayPrimStatistics("Lazy (complete graph)", lazyStatistics);
+    displayPrimStatistics("Eager (complete graph)", eagerStatistics);
 
     return 0;
 }
 
+// Minimum Spanning Tree Edges:
+// (A, B) -> Cost: 2
+// (B, C) -> Cost: 3
+// (B, E) -> Cost: 5
+// (A, D) -> Cost: 6
+// Total Weight of MST: 16
+// Minimum Spanning Tree Edges:
 // (A, B) -> Cost: 2
 // (B, C) -> Cost: 3
 // (B, E) -> Cost: 5
 // (A, D) -> Cost: 6
-// Total Weight of MST: 16
\ No newline at end of file
+// Total Weight of MST: 16
+// Lazy: peak heap size 4, pushes 7, pops 4 (stale 0), decrease-keys 0
+// Eager: peak heap size 3, pushes 4, pops 4 (stale 0), decrease-keys 0
+// Lazy (complete graph): peak heap size 20, pushes 28, pops 11 (stale 4), decrease-keys 0
+// Eager (complete graph): peak heap size 7, pushes 7, pops 7 (stale 0), decrease-keys 21
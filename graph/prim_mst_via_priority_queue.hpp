@@ -0,0 +1,301 @@
+/**
+ * @file prim_mst_via_priority_queue.hpp
+ * @brief Prim's Minimum Spanning Tree Algorithm using Priority Queue (Adjacency List) built with using C++.
+ *        Besides the string-keyed adjacency list, a compressed sparse row (CSR) graph (compressed_sparse_row_graph.hpp) over dense uint32 vertex IDs is supported.
+ *        The string-keyed version is a front end interning the vertex names into the IDs, then running the CSR version.
+ *        It is shared by prim_mst_via_priority_queue.cpp (example) and the other MST programs (e.g. mst_benchmark.cpp).
+ */
+
+#ifndef PRIM_MST_VIA_PRIORITY_QUEUE_HPP
+#define PRIM_MST_VIA_PRIORITY_QUEUE_HPP
+
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <string>
+#include <tuple>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include "compressed_sparse_row_graph.hpp"
+
+// The variants of Prim's Algorithm
+//  - Lazy: every edge leaving the tree is pushed, and the stale ones (whose destination joined the tree meanwhile) are skipped when popped.
+//          The heap grows up to O(E), but a push is cheap; suited for sparse graphs.
+//  - Eager: the heap keeps at most one entry per frontier vertex (its cheapest edge to the tree), updated by decrease-key.
+//           The heap is bounded by O(V) and no pop is wasted; suited for dense graphs.
+enum class PrimMode {
+    Lazy,
+    Eager
+};
+
+// The heap statistics of a run, to choose the mode per graph density
+struct PrimStatistics {
+    std::size_t peakHeapSize = 0;       // The largest number of entries in the heap at once
+    std::size_t heapPushes = 0;         // The number of inserted entries
+    std::size_t heapPops = 0;           // The number of popped entries (including the stale ones)
+    std::size_t stalePops = 0;          // The number of popped entries skipped as stale (always 0 in the eager mode)
+    std::size_t decreaseKeys = 0;       // The number of decrease-key operations (always 0 in the lazy mode)
+};
+
+// An indexed binary min heap of vertices keyed by the weight of their cheapest edge to the tree (for the eager mode)
+// heapPositions[v] is the index of v in the heap array (or NOT_IN_HEAP), so the entry of a vertex can be found and decreased in O(log V).
+template <typename EdgeWeightType>
+class IndexedMinHeap {
+private:
+    std::vector<std::uint32_t> heap;
+    std::vector<std::uint32_t> heapPositions;
+    const std::vector<EdgeWeightType>& keys;
+
+    void swapEntries(std::size_t index1, std::size_t index2) {
+        std::swap(heap[index1], heap[index2]);
+        heapPositions[heap[index1]] = static_cast<std::uint32_t>(index1);
+        heapPositions[heap[index2]] = static_cast<std::uint32_t>(index2);
+    }
+
+    void siftUp(std::size_t index) {
+        while (index > 0) {
+            std::size_t parentIndex = (index - 1) / 2;
+            if (!(keys[heap[index]] < keys[heap[parentIndex]]))
+                break;
+            swapEntries(index, parentIndex);
+            index = parentIndex;
+        }
+    }
+
+    void siftDown(std::size_t index) {
+        while (true) {
+            std::size_t smallestIndex = index;
+            std::size_t leftChildIndex = 2 * index + 1;
+            std::size_t rightChildIndex = 2 * index + 2;
+            if (leftChildIndex < heap.size() && keys[heap[leftChildIndex]] < keys[heap[smallestIndex]])
+                smallestIndex = leftChildIndex;
+            if (rightChildIndex < heap.size() && keys[heap[rightChildIndex]] < keys[heap[smallestIndex]])
+                smallestIndex = rightChildIndex;
+            if (smallestIndex == index)
+                break;
+            swapEntries(index, smallestIndex);
+            index = smallestIndex;
+        }
+    }
+
+public:
+    static constexpr std::uint32_t NOT_IN_HEAP = UINT32_MAX;
+
+    // The keys are owned by the caller; keys[v] must be updated before insert(v) or decreaseKey(v)
+    IndexedMinHeap(std::uint32_t numberOfVertices, const std::vector<EdgeWeightType>& keys)
+        : heapPositions(numberOfVertices, NOT_IN_HEAP), keys(keys) {}
+
+    bool empty() const { return heap.empty(); }
+    std::size_t size() const { return heap.size(); }
+    bool contains(std::uint32_t vertex) const { return heapPositions[vertex] != NOT_IN_HEAP; }
+
+    void insert(std::uint32_t vertex) {
+        heapPositions[vertex] = static_cast<std::uint32_t>(heap.size());
+        heap.push_back(vertex);
+        siftUp(heap.size() - 1);
+    }
+
+    void decreaseKey(std::uint32_t vertex) {
+        siftUp(heapPositions[vertex]);
+    }
+
+    std::uint32_t extractMin() {
+        std::uint32_t minimumVertex = heap[0];
+        swapEntries(0, heap.size() - 1);
+        heap.pop_back();
+        heapPositions[minimumVertex] = NOT_IN_HEAP;
+        if (!heap.empty())
+            siftDown(0);
+        return minimumVertex;
+    }
+};
+
+template <typename EdgeWeightType>
+constexpr std::uint32_t IndexedMinHeap<EdgeWeightType>::NOT_IN_HEAP;
+
+// Function to find the Minimum Spanning Tree (of the component of startingVertex) using lazy Prim's Algorithm over a CSR graph
+// Compared to the string-keyed version:
+//  - a heap entry is (weight, source ID, destination ID); 12 bytes for int weights and 16 bytes for double weights, no string copy
+//  - the visited vertices are a bitset (1 bit per vertex) instead of unordered_map<string, bool>
+template <typename EdgeWeightType>
+std::vector<WeightedEdge<EdgeWeightType>> lazyPrimMST(const CsrGraph<EdgeWeightType>& graph, std::uint32_t startingVertex, PrimStatistics& statistics) {
+    struct HeapEntry {
+        EdgeWeightType weight;
+        std::uint32_t source;
+        std::uint32_t destination;
+    };
+    struct HeapEntryCompare {
+        bool operator()(const HeapEntry& entry1, const HeapEntry& entry2) const {
+            return entry1.weight > entry2.weight;
+        }
+    };
+
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, HeapEntryCompare> priorityQueue;
+    std::vector<std::uint64_t> visitedVertices((numberOfVertices + 63) / 64, 0);
+    auto isVisited = [&visitedVertices](std::uint32_t vertex) { return (visitedVertices[vertex / 64] >> (vertex % 64)) & 1; };
+    auto markVisited = [&visitedVertices](std::uint32_t vertex) { visitedVertices[vertex / 64] |= std::uint64_t(1) << (vertex % 64); };
+    auto pushEdgesOf = [&](std::uint32_t vertex) {
+        for (std::uint32_t edge = graph.offsets[vertex]; edge < graph.offsets[vertex + 1]; edge++) {
+            if (!isVisited(graph.targets[edge])) {
+                priorityQueue.push(HeapEntry{graph.weights[edge], vertex, graph.targets[edge]});
+                statistics.heapPushes++;
+            }
+        }
+        statistics.peakHeapSize = std::max(statistics.peakHeapSize, priorityQueue.size());
+    };
+
+    std::vector<WeightedEdge<EdgeWeightType>> mstEdges;
+    mstEdges.reserve(numberOfVertices - 1);
+
+    // Initialize the starting vertex and its adjacencies
+    markVisited(startingVertex);
+    pushEdgesOf(startingVertex);
+
+    // Loop until the priority queue is empty (or every vertex is in the MST)
+    while (!priorityQueue.empty() && mstEdges.size() + 1 < numberOfVertices) {
+        HeapEntry entry = priorityQueue.top();
+        priorityQueue.pop();
+        statistics.heapPops++;
+
+        // If the destination vertex is already visited, skip the edge
+        if (isVisited(entry.destination)) {
+            statistics.stalePops++;
+            continue;
+        }
+
+        // Include the edge in the MST, and add the destination vertex's adjacencies to the priority queue
+        markVisited(entry.destination);
+        mstEdges.push_back(WeightedEdge<EdgeWeightType>{entry.source, entry.destination, entry.weight});
+        pushEdgesOf(entry.destination);
+    }
+
+    return mstEdges;
+}
+
+// Function to find the Minimum Spanning Tree (of the component of startingVertex) using eager Prim's Algorithm over a CSR graph
+// bestWeights[v] and bestSources[v] hold the cheapest known edge from the tree to the frontier vertex v.
+template <typename EdgeWeightType>
+std::vector<WeightedEdge<EdgeWeightType>> eagerPrimMST(const CsrGraph<EdgeWeightType>& graph, std::uint32_t startingVertex, PrimStatistics& statistics) {
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+    std::vector<EdgeWeightType> bestWeights(numberOfVertices);
+    std::vector<std::uint32_t> bestSources(numberOfVertices);
+    std::vector<std::uint64_t> visitedVertices((numberOfVertices + 63) / 64, 0);
+    auto isVisited = [&visitedVertices](std::uint32_t vertex) { return (visitedVertices[vertex / 64] >> (vertex % 64)) & 1; };
+    auto markVisited = [&visitedVertices](std::uint32_t vertex) { visitedVertices[vertex / 64] |= std::uint64_t(1) << (vertex % 64); };
+
+    IndexedMinHeap<EdgeWeightType> frontier(numberOfVertices, bestWeights);
+    auto relaxEdgesOf = [&](std::uint32_t vertex) {
+        for (std::uint32_t edge = graph.offsets[vertex]; edge < graph.offsets[vertex + 1]; edge++) {
+            std::uint32_t neighbour = graph.targets[edge];
+            if (isVisited(neighbour))
+                continue;
+            if (!frontier.contains(neighbour)) {
+                bestWeights[neighbour] = graph.weights[edge];
+                bestSources[neighbour] = vertex;
+                frontier.insert(neighbour);
+                statistics.heapPushes++;
+            } else if (graph.weights[edge] < bestWeights[neighbour]) {
+                bestWeights[neighbour] = graph.weights[edge];
+                bestSources[neighbour] = vertex;
+                frontier.decreaseKey(neighbour);
+                statistics.decreaseKeys++;
+            }
+        }
+        statistics.peakHeapSize = std::max(statistics.peakHeapSize, frontier.size());
+    };
+
+    std::vector<WeightedEdge<EdgeWeightType>> mstEdges;
+    mstEdges.reserve(numberOfVertices - 1);
+
+    markVisited(startingVertex);
+    relaxEdgesOf(startingVertex);
+
+    // Every popped vertex joins the tree through its cheapest edge; there is no stale entry to skip
+    while (!frontier.empty()) {
+        std::uint32_t vertex = frontier.extractMin();
+        statistics.heapPops++;
+        markVisited(vertex);
+        mstEdges.push_back(WeightedEdge<EdgeWeightType>{bestSources[vertex], vertex, bestWeights[vertex]});
+        relaxEdgesOf(vertex);
+    }
+
+    return mstEdges;
+}
+
+// Function to find the Minimum Spanning Tree (of the component of startingVertex) using Prim's Algorithm over a CSR graph
+// The MST edges are returned in the order they are added; the heap statistics are written to statistics if given.
+template <typename EdgeWeightType>
+std::vector<WeightedEdge<EdgeWeightType>> primMST(const CsrGraph<EdgeWeightType>& graph, std::uint32_t startingVertex,
+                                                  PrimMode mode = PrimMode::Lazy, PrimStatistics* statistics = nullptr) {
+    if (startingVertex >= graph.getNumberOfVertices()) {
+        throw std::out_of_range("Invalid starting vertex");
+    }
+
+    PrimStatistics runStatistics;
+    std::vector<WeightedEdge<EdgeWeightType>> mstEdges = (mode == PrimMode::Eager) ? eagerPrimMST(graph, startingVertex, runStatistics)
+                                                                                  : lazyPrimMST(graph, startingVertex, runStatistics);
+    if (statistics != nullptr) {
+        *statistics = runStatistics;
+    }
+    return mstEdges;
+}
+
+// A string-keyed graph interned into a CSR graph; vertex names are mapped to dense IDs and back
+template <typename EdgeWeightType>
+struct InternedGraph {
+    CsrGraph<EdgeWeightType> graph;
+    std::unordered_map<std::string, std::uint32_t> vertexToId;
+    std::vector<std::string> idToVertex;
+
+    // Get the ID of a vertex name, assigning a new one for a name seen for the first time
+    std::uint32_t intern(const std::string& vertex) {
+        auto insertion = vertexToId.insert({vertex, static_cast<std::uint32_t>(idToVertex.size())});
+        if (insertion.second) {
+            idToVertex.push_back(vertex);
+        }
+        return insertion.first->second;
+    }
+};
+
+// Function to intern a string-keyed adjacency list <startingVertex, <destinationVertex, weight>> into a CSR graph
+// Every string is hashed once here, instead of on every heap push and visited lookup.
+template <typename EdgeWeightType>
+InternedGraph<EdgeWeightType> internGraph(const std::unordered_map<std::string, std::vector<std::pair<std::string, EdgeWeightType>>>& graphAdjacencyList) {
+    InternedGraph<EdgeWeightType> internedGraph;
+    std::vector<WeightedEdge<EdgeWeightType>> edges;
+    for (const auto& vertexAdjacency : graphAdjacencyList) {
+        std::uint32_t sourceId = internedGraph.intern(vertexAdjacency.first);
+        for (const auto& neighbour : vertexAdjacency.second) {
+            edges.push_back(WeightedEdge<EdgeWeightType>{sourceId, internedGraph.intern(neighbour.first), neighbour.second});
+        }
+    }
+    internedGraph.graph = buildCsrGraph(static_cast<std::uint32_t>(internedGraph.idToVertex.size()), edges);
+    return internedGraph;
+}
+
+// Function to find the Minimum Spanning Tree using Prim's Algorithm
+// The graph is represented as <startingVertex, <destinationVertex, weight>>
+// The vertex names are interned into dense IDs, and the CSR version does the work.
+// The MST edges are returned as (source, destination, weight) in the order they are added.
+template <typename EdgeWeightType>      // WeightType is the type of the weight of the edge (int, double, float, etc.)
+std::vector<std::tuple<std::string, std::string, EdgeWeightType>> primMST(
+        const std::unordered_map<std::string, std::vector<std::pair<std::string, EdgeWeightType>>>& graphAdjacencyList,
+        const std::string& startingVertex, PrimMode mode = PrimMode::Lazy, PrimStatistics* statistics = nullptr) {
+    if (graphAdjacencyList.find(startingVertex) == graphAdjacencyList.end()) {
+        throw std::out_of_range("Invalid starting vertex");
+    }
+
+    InternedGraph<EdgeWeightType> internedGraph = internGraph(graphAdjacencyList);
+    std::vector<WeightedEdge<EdgeWeightType>> mstEdges = primMST(internedGraph.graph, internedGraph.vertexToId.at(startingVertex), mode, statistics);
+
+    std::vector<std::tuple<std::string, std::string, EdgeWeightType>> namedMstEdges;
+    namedMstEdges.reserve(mstEdges.size());
+    for (const auto& edge : mstEdges) {
+        namedMstEdges.emplace_back(internedGraph.idToVertex[edge.source], internedGraph.idToVertex[edge.destination], edge.weight);
+    }
+    return namedMstEdges;
+}
+
+#endif // PRIM_MST_VIA_PRIORITY_QUEUE_HPP
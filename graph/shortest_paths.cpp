@@ -0,0 +1,88 @@
+/**
+ * @file shortest_paths.cpp
+ * @brief Examples of the shortest path algorithms of shortest_paths.hpp; Dijkstra's Algorithm on both heaps, delta-stepping,
+ *        and bidirectional Dijkstra over a small weighted directed graph
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread shortest_paths.cpp -o shortest_paths
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include <cstdint>
+#include "compressed_sparse_row_graph.hpp"
+#include "shortest_paths.hpp"
+
+// A helper method to print the distance and the parent of every vertex
+void displayShortestPaths(const ShortestPaths<std::uint32_t>& shortestPaths) {
+    for (std::size_t vertex = 0; vertex < shortestPaths.distances.size(); vertex++) {
+        std::cout << "VERTEX " << vertex << ": ";
+        if (shortestPaths.parents[vertex] == ShortestPaths<std::uint32_t>::NO_PARENT) {
+            std::cout << "unreached" << std::endl;
+        } else {
+            std::cout << "distance " << shortestPaths.distances[vertex] << ", parent " << shortestPaths.parents[vertex] << std::endl;
+        }
+    }
+}
+
+// A helper method to print the statistics of a search
+void displayStatistics(const std::string& algorithmName, const ShortestPathStatistics& statistics) {
+    std::cout << algorithmName << ": relaxations " << statistics.relaxations << ", distance updates " << statistics.distanceUpdates
+              << ", heap pops " << statistics.heapPops << " (stale " << statistics.stalePops << "), phases " << statistics.phases << std::endl;
+}
+
+int main(void) {
+    // A directed graph with 7 vertices (travel times in minutes); vertex 6 cannot be reached from vertex 0
+    std::vector<WeightedEdge<std::uint32_t>> edges = {{0, 1, 7}, {0, 2, 9}, {0, 5, 14}, {1, 2, 10}, {1, 3, 15}, {2, 3, 11},
+                                                      {2, 5, 2}, {3, 4, 6}, {5, 4, 9}, {4, 0, 3}, {6, 4, 1}};
+    CsrGraph<std::uint32_t> graph = buildCsrGraph(7, edges);
+
+    ShortestPathStatistics binaryStatistics, radixStatistics, deltaSteppingStatistics, bidirectionalStatistics;
+    ShortestPaths<std::uint32_t> binaryResult = dijkstraShortestPaths(graph, 0, DijkstraHeap::Binary, &binaryStatistics);
+    ShortestPaths<std::uint32_t> radixResult = dijkstraShortestPaths(graph, 0, DijkstraHeap::Radix, &radixStatistics);
+    std::cout << "Dijkstra from vertex 0:" << std::endl;
+    displayShortestPaths(binaryResult);
+
+    // Bucket width 5; the edges up to 5 minutes are light
+    DeltaSteppingShortestPaths<std::uint32_t> deltaStepping(graph, 5, 2);
+    ShortestPaths<std::uint32_t> deltaSteppingResult = deltaStepping.search(0, &deltaSteppingStatistics);
+    std::cout << "Same distances on the radix heap and with delta-stepping: "
+              << (radixResult.distances == binaryResult.distances && deltaSteppingResult.distances == binaryResult.distances ? "Yes" : "No") << std::endl;
+
+    PointToPointPath<std::uint32_t> path = bidirectionalDijkstra(graph, transposeCsrGraph(graph), 1, 4, &bidirectionalStatistics);
+    std::cout << "Shortest path from vertex 1 to vertex 4 (distance " << path.distance << "):";
+    for (std::uint32_t vertex : path.path) {
+        std::cout << " " << vertex;
+    }
+    std::cout << std::endl;
+
+    displayStatistics("Dijkstra (binary heap)", binaryStatistics);
+    displayStatistics("Dijkstra (radix heap)", radixStatistics);
+    displayStatistics("Delta-stepping", deltaSteppingStatistics);
+    displayStatistics("Bidirectional Dijkstra", bidirectionalStatistics);
+
+    try {
+        dijkstraShortestPaths(buildCsrGraph(2, std::vector<WeightedEdge<int>>{{0, 1, -1}}), 0);
+    } catch (const std::invalid_argument& exception) {
+        std::cout << "Dijkstra with a negative edge weight: " << exception.what() << std::endl;
+    }
+
+    return 0;
+}
+
+// Dijkstra from vertex 0:
+// VERTEX 0: distance 0, parent 0
+// VERTEX 1: distance 7, parent 0
+// VERTEX 2: distance 9, parent 0
+// VERTEX 3: distance 20, parent 2
+// VERTEX 4: distance 20, parent 5
+// VERTEX 5: distance 11, parent 2
+// VERTEX 6: unreached
+// Same distances on the radix heap and with delta-stepping: Yes
+// Shortest path from vertex 1 to vertex 4 (distance 21): 1 3 4
+// Dijkstra (binary heap): relaxations 10, distance updates 7, heap pops 8 (stale 2), phases 0
+// Dijkstra (radix heap): relaxations 10, distance updates 7, heap pops 8 (stale 2), phases 0
+// Delta-stepping: relaxations 10, distance updates 6, heap pops 0 (stale 0), phases 8
+// Bidirectional Dijkstra: relaxations 9, distance updates 7, heap pops 5 (stale 0), phases 0
+// Dijkstra with a negative edge weight: Negative edge weight
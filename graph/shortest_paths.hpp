@@ -0,0 +1,481 @@
+/**
+ * @file shortest_paths.hpp
+ * @brief Single-source and point-to-point shortest paths over a weighted CSR graph (compressed_sparse_row_graph.hpp) in C++ language
+ *        - Dijkstra's Algorithm with the array heap of priority_queue/ (priority_queue_via_max_heap_array.hpp) or a radix heap (integer weights)
+ *        - Delta-stepping; the vertices are kept in buckets of width delta, and each bucket is settled with parallel relaxations
+ *        - Bidirectional Dijkstra for a single (source, target) query; a forward search from the source and a backward one from the target
+ *        Every edge weight must be non-negative, and the weight type must hold the lengths of the paths.
+ *        It is shared by shortest_paths.cpp (example) and shortest_paths_benchmark.cpp (benchmark).
+ */
+
+#ifndef SHORTEST_PATHS_HPP
+#define SHORTEST_PATHS_HPP
+
+#include <vector>
+#include <utility>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include "compressed_sparse_row_graph.hpp"
+#include "../priority_queue/priority_queue_via_max_heap_array.hpp"
+
+// The heaps Dijkstra's Algorithm can run on
+//  - Binary: the array heap of priority_queue/ with an inverted comparator (a min heap), with lazy deletion (stale entries are skipped).
+//  - Radix: a monotone radix heap; an entry only moves to a lower one of 65 buckets, so a push is O(1) and a pop is amortized O(log C)
+//           for the largest weight C. It needs integer weights.
+enum class DijkstraHeap {
+    Binary,
+    Radix
+};
+
+// The result of a single-source search; distances[v] is the length of a shortest path from the source to v, and parents[v] is the vertex
+// before v on it (the source is its own parent). An unreached vertex has the largest weight as its distance and NO_PARENT as its parent.
+template <typename EdgeWeightType>
+struct ShortestPaths {
+    static constexpr std::uint32_t NO_PARENT = UINT32_MAX;
+
+    std::vector<EdgeWeightType> distances;
+    std::vector<std::uint32_t> parents;
+};
+
+template <typename EdgeWeightType>
+constexpr std::uint32_t ShortestPaths<EdgeWeightType>::NO_PARENT;
+
+// The result of a point-to-point search; the vertices of a shortest path from the source to the target (empty if unreachable)
+template <typename EdgeWeightType>
+struct PointToPointPath {
+    EdgeWeightType distance;
+    std::vector<std::uint32_t> path;
+};
+
+// The statistics of a search
+struct ShortestPathStatistics {
+    std::size_t relaxations = 0;        // The number of edges examined
+    std::size_t distanceUpdates = 0;    // The number of relaxations shortening a distance
+    std::size_t heapPops = 0;           // The number of popped heap entries (Dijkstra), including the stale ones
+    std::size_t stalePops = 0;          // The number of popped heap entries skipped as stale
+    std::size_t phases = 0;             // The number of light and heavy relaxation phases (delta-stepping)
+};
+
+// Helper function to check that every edge weight is non-negative, returning the largest one
+template <typename EdgeWeightType>
+EdgeWeightType findLargestEdgeWeight(const CsrGraph<EdgeWeightType>& graph) {
+    if (graph.weights.size() != graph.targets.size()) {
+        throw std::invalid_argument("The graph has no edge weights");
+    }
+    EdgeWeightType largestWeight = EdgeWeightType();
+    for (const EdgeWeightType& weight : graph.weights) {
+        if (weight < EdgeWeightType()) {
+            throw std::invalid_argument("Negative edge weight");
+        }
+        largestWeight = std::max(largestWeight, weight);
+    }
+    return largestWeight;
+}
+
+// A monotone radix heap of (key, vertex) entries; the popped keys never decrease, and a key below the last popped one cannot be pushed
+// Bucket 0 holds the keys equal to the last popped key, and bucket i > 0 the keys whose highest bit differing from it is bit i - 1.
+// When bucket 0 runs out, the first non-empty bucket is redistributed around its smallest key; each entry only moves down, at most 64 times.
+class RadixHeap {
+private:
+    static constexpr unsigned int NUMBER_OF_BUCKETS = 65;
+
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> buckets[NUMBER_OF_BUCKETS];
+    std::uint64_t lastKey = 0;
+    unsigned int size = 0;
+
+    // Helper method to find the bucket of a key relative to the last popped key
+    static unsigned int getBucketIndex(std::uint64_t key, std::uint64_t lastKey) {
+        if (key == lastKey)
+            return 0;
+#if defined(__GNUC__)
+        return 64 - static_cast<unsigned int>(__builtin_clzll(key ^ lastKey));
+#else
+        unsigned int bucketIndex = 0;
+        for (std::uint64_t differingBits = key ^ lastKey; differingBits != 0; differingBits >>= 1) {
+            bucketIndex++;
+        }
+        return bucketIndex;
+#endif
+    }
+
+public:
+    void insert(std::pair<std::uint64_t, std::uint32_t> entry) {
+        if (entry.first < this->lastKey) {
+            throw std::invalid_argument("Radix heap keys must not be below the last removed key");
+        }
+        this->buckets[getBucketIndex(entry.first, this->lastKey)].push_back(entry);
+        this->size++;
+    }
+
+    std::pair<std::uint64_t, std::uint32_t> remove() {
+        if (this->size == 0) {
+            throw std::out_of_range("Radix heap is empty");
+        }
+        if (this->buckets[0].empty()) {
+            unsigned int bucketIndex = 1;
+            while (this->buckets[bucketIndex].empty()) {
+                bucketIndex++;
+            }
+            std::vector<std::pair<std::uint64_t, std::uint32_t>>& bucket = this->buckets[bucketIndex];
+            this->lastKey = std::min_element(bucket.begin(), bucket.end())->first;
+            for (const std::pair<std::uint64_t, std::uint32_t>& entry : bucket) {
+                this->buckets[getBucketIndex(entry.first, this->lastKey)].push_back(entry);
+            }
+            bucket.clear();
+        }
+        std::pair<std::uint64_t, std::uint32_t> entry = this->buckets[0].back();
+        this->buckets[0].pop_back();
+        this->size--;
+        return entry;
+    }
+
+    unsigned int getSize() const { return this->size; }
+};
+
+constexpr unsigned int RadixHeap::NUMBER_OF_BUCKETS;
+
+// Helper function running Dijkstra's Algorithm on a heap of (key, vertex) entries, with lazy deletion
+// HeapType has the interface of PriorityQueueViaMaxHeapArray (insert, remove, getSize), and remove() returns the entry with the smallest key.
+template <typename EdgeWeightType, typename HeapType>
+ShortestPaths<EdgeWeightType> dijkstraWithHeap(const CsrGraph<EdgeWeightType>& graph, std::uint32_t sourceVertex, HeapType& heap, ShortestPathStatistics& statistics) {
+    typedef typename std::remove_reference<decltype(heap.remove())>::type::first_type KeyType;
+    ShortestPaths<EdgeWeightType> shortestPaths;
+    shortestPaths.distances.assign(graph.getNumberOfVertices(), std::numeric_limits<EdgeWeightType>::max());
+    shortestPaths.parents.assign(graph.getNumberOfVertices(), ShortestPaths<EdgeWeightType>::NO_PARENT);
+    shortestPaths.distances[sourceVertex] = EdgeWeightType();
+    shortestPaths.parents[sourceVertex] = sourceVertex;
+    heap.insert(std::make_pair(KeyType(), sourceVertex));
+
+    while (heap.getSize() > 0) {
+        const std::pair<KeyType, std::uint32_t> entry = heap.remove();
+        const EdgeWeightType distance = static_cast<EdgeWeightType>(entry.first);
+        const std::uint32_t vertex = entry.second;
+        statistics.heapPops++;
+        if (shortestPaths.distances[vertex] < distance) {
+            statistics.stalePops++;         // The vertex was settled by a shorter entry already
+            continue;
+        }
+        for (std::uint32_t edgeIndex = graph.offsets[vertex]; edgeIndex < graph.offsets[vertex + 1]; edgeIndex++) {
+            const std::uint32_t adjacentVertex = graph.targets[edgeIndex];
+            const EdgeWeightType newDistance = distance + graph.weights[edgeIndex];
+            statistics.relaxations++;
+            if (newDistance < shortestPaths.distances[adjacentVertex]) {
+                shortestPaths.distances[adjacentVertex] = newDistance;
+                shortestPaths.parents[adjacentVertex] = vertex;
+                statistics.distanceUpdates++;
+                heap.insert(std::make_pair(static_cast<KeyType>(newDistance), adjacentVertex));
+            }
+        }
+    }
+    return shortestPaths;
+}
+
+// Function to find the shortest paths from sourceVertex to every vertex with Dijkstra's Algorithm in O((n + m) log n) (binary heap)
+template <typename EdgeWeightType>
+ShortestPaths<EdgeWeightType> dijkstraShortestPaths(const CsrGraph<EdgeWeightType>& graph, std::uint32_t sourceVertex,
+                                                    DijkstraHeap heapType = DijkstraHeap::Binary, ShortestPathStatistics* statistics = nullptr) {
+    if (sourceVertex >= graph.getNumberOfVertices()) {
+        throw std::out_of_range("Invalid source vertex");
+    }
+    findLargestEdgeWeight(graph);
+
+    ShortestPathStatistics searchStatistics;
+    ShortestPaths<EdgeWeightType> shortestPaths;
+    if (heapType == DijkstraHeap::Radix) {
+        if (!std::is_integral<EdgeWeightType>::value) {
+            throw std::invalid_argument("The radix heap needs integer edge weights");
+        }
+        RadixHeap heap;
+        shortestPaths = dijkstraWithHeap(graph, sourceVertex, heap, searchStatistics);
+    } else {
+        // The pairs compare by the distance first, so the inverted comparator puts the smallest distance at the root
+        PriorityQueueViaMaxHeapArray<std::pair<EdgeWeightType, std::uint32_t>, std::greater<std::pair<EdgeWeightType, std::uint32_t>>> heap;
+        shortestPaths = dijkstraWithHeap(graph, sourceVertex, heap, searchStatistics);
+    }
+    if (statistics != nullptr) {
+        *statistics = searchStatistics;
+    }
+    return shortestPaths;
+}
+
+// Function to find a shortest path from sourceVertex to targetVertex with bidirectional Dijkstra
+// The forward search runs on the graph and the backward one on its transposed graph (transposeCsrGraph), the one with the smaller heap
+// taking the next step. Every edge scanned between the two searched regions offers a path; the search stops once the smallest keys
+// of the two heaps add up to at least the shortest path offered, so only about two balls of half the radius are searched.
+// With floating point weights, the distance may differ from the one of dijkstraShortestPaths in the last bits, as it is summed from both ends.
+template <typename EdgeWeightType>
+PointToPointPath<EdgeWeightType> bidirectionalDijkstra(const CsrGraph<EdgeWeightType>& graph, const CsrGraph<EdgeWeightType>& transposedGraph,
+                                                       std::uint32_t sourceVertex, std::uint32_t targetVertex, ShortestPathStatistics* statistics = nullptr) {
+    typedef PriorityQueueViaMaxHeapArray<std::pair<EdgeWeightType, std::uint32_t>, std::greater<std::pair<EdgeWeightType, std::uint32_t>>> MinHeap;
+    const std::uint32_t numberOfVertices = graph.getNumberOfVertices();
+    const EdgeWeightType INFINITE_DISTANCE = std::numeric_limits<EdgeWeightType>::max();
+    const std::uint32_t NO_PARENT = ShortestPaths<EdgeWeightType>::NO_PARENT;
+    if (sourceVertex >= numberOfVertices || targetVertex >= numberOfVertices) {
+        throw std::out_of_range("Invalid source or target vertex");
+    }
+    if (transposedGraph.getNumberOfVertices() != numberOfVertices || transposedGraph.getNumberOfEdges() != graph.getNumberOfEdges()) {
+        throw std::invalid_argument("The transposed graph does not match the graph");
+    }
+    findLargestEdgeWeight(graph);
+
+    // Index 0 is the forward search, index 1 the backward one
+    const CsrGraph<EdgeWeightType>* searchGraphs[2] = {&graph, &transposedGraph};
+    std::vector<EdgeWeightType> distances[2] = {std::vector<EdgeWeightType>(numberOfVertices, INFINITE_DISTANCE),
+                                                std::vector<EdgeWeightType>(numberOfVertices, INFINITE_DISTANCE)};
+    std::vector<std::uint32_t> parents[2] = {std::vector<std::uint32_t>(numberOfVertices, NO_PARENT), std::vector<std::uint32_t>(numberOfVertices, NO_PARENT)};
+    MinHeap heaps[2];
+    distances[0][sourceVertex] = distances[1][targetVertex] = EdgeWeightType();
+    parents[0][sourceVertex] = sourceVertex;
+    parents[1][targetVertex] = targetVertex;
+    heaps[0].insert(std::make_pair(EdgeWeightType(), sourceVertex));
+    heaps[1].insert(std::make_pair(EdgeWeightType(), targetVertex));
+
+    ShortestPathStatistics searchStatistics;
+    EdgeWeightType bestDistance = (sourceVertex == targetVertex) ? EdgeWeightType() : INFINITE_DISTANCE;
+    std::uint32_t meetingVertex = (sourceVertex == targetVertex) ? sourceVertex : NO_PARENT;
+    while (heaps[0].getSize() > 0 && heaps[1].getSize() > 0) {
+        const EdgeWeightType forwardKey = heaps[0].getMax().first, backwardKey = heaps[1].getMax().first;
+        if (bestDistance != INFINITE_DISTANCE && forwardKey + backwardKey >= bestDistance)
+            break;
+
+        const unsigned int direction = (heaps[0].getSize() <= heaps[1].getSize()) ? 0 : 1;
+        const std::pair<EdgeWeightType, std::uint32_t> entry = heaps[direction].remove();
+        const EdgeWeightType distance = entry.first;
+        const std::uint32_t vertex = entry.second;
+        searchStatistics.heapPops++;
+        if (distances[direction][vertex] < distance) {
+            searchStatistics.stalePops++;
+            continue;
+        }
+        const CsrGraph<EdgeWeightType>& searchGraph = *searchGraphs[direction];
+        for (std::uint32_t edgeIndex = searchGraph.offsets[vertex]; edgeIndex < searchGraph.offsets[vertex + 1]; edgeIndex++) {
+            const std::uint32_t adjacentVertex = searchGraph.targets[edgeIndex];
+            const EdgeWeightType newDistance = distance + searchGraph.weights[edgeIndex];
+            searchStatistics.relaxations++;
+            if (newDistance < distances[direction][adjacentVertex]) {
+                distances[direction][adjacentVertex] = newDistance;
+                parents[direction][adjacentVertex] = vertex;
+                searchStatistics.distanceUpdates++;
+                heaps[direction].insert(std::make_pair(newDistance, adjacentVertex));
+            }
+            const EdgeWeightType otherDistance = distances[1 - direction][adjacentVertex];
+            if (otherDistance != INFINITE_DISTANCE && newDistance + otherDistance < bestDistance) {
+                bestDistance = newDistance + otherDistance;
+                meetingVertex = adjacentVertex;
+            }
+        }
+    }
+
+    PointToPointPath<EdgeWeightType> result;
+    result.distance = bestDistance;
+    if (meetingVertex != NO_PARENT) {
+        // The forward half from the source to the meeting vertex, then the backward half from it to the target
+        for (std::uint32_t vertex = meetingVertex; ; vertex = parents[0][vertex]) {
+            result.path.push_back(vertex);
+            if (vertex == sourceVertex)
+                break;
+        }
+        std::reverse(result.path.begin(), result.path.end());
+        for (std::uint32_t vertex = meetingVertex; vertex != targetVertex; ) {
+            vertex = parents[1][vertex];
+            result.path.push_back(vertex);
+        }
+    }
+    if (statistics != nullptr) {
+        *statistics = searchStatistics;
+    }
+    return result;
+}
+
+// Delta-stepping single-source shortest paths over a CSR graph, parallelized over threads
+// A vertex with tentative distance d is kept in bucket floor(d / delta). The buckets are settled in order; the light edges (weight <= delta)
+// of the current bucket are relaxed repeatedly, as they may put vertices back into it, then the heavy edges of the settled vertices once.
+// Each relaxation phase is split in two, so no distance needs an atomic update:
+//  1. the threads scan the edges of their part of the bucket and send the improving requests (vertex, distance, parent) to the owner of the vertex
+//  2. each owner applies the requests to its own vertices (v % numThreads)
+// A small delta does little wasted work but has many phases (Dijkstra at the limit), and a large one few phases but more re-relaxations
+// (Bellman-Ford at the limit). Only floor(largest weight / delta) + 2 buckets are live at once, so they are kept in a ring.
+template <typename EdgeWeightType>
+class DeltaSteppingShortestPaths {
+private:
+    // A request to shorten the distance of a vertex
+    struct RelaxationRequest {
+        std::uint32_t vertex;
+        std::uint32_t parentVertex;
+        EdgeWeightType distance;
+    };
+
+    static constexpr std::size_t PARALLEL_GRAIN_SIZE = 1 << 10;    // The smallest work of a thread of its own (vertices or requests)
+
+    const CsrGraph<EdgeWeightType>& graph;
+    EdgeWeightType bucketWidth;
+    std::size_t numberOfBuckets;
+    unsigned int numThreads;
+
+    void parallelFor(std::size_t count, std::size_t grainSize, const std::function<void(unsigned int, std::size_t, std::size_t)>& body) const;
+
+public:
+    DeltaSteppingShortestPaths(const CsrGraph<EdgeWeightType>& graph, EdgeWeightType bucketWidth,
+                               unsigned int numThreads = std::thread::hardware_concurrency())
+        : graph(graph), bucketWidth(bucketWidth) {
+        if (!(bucketWidth > EdgeWeightType())) {
+            throw std::invalid_argument("The bucket width must be positive");
+        }
+        this->numberOfBuckets = static_cast<std::size_t>(findLargestEdgeWeight(graph) / bucketWidth) + 2;
+        this->numThreads = (numThreads == 0) ? 1 : numThreads;
+    }
+
+    ShortestPaths<EdgeWeightType> search(std::uint32_t sourceVertex, ShortestPathStatistics* statistics = nullptr) const;
+};
+
+template <typename EdgeWeightType>
+constexpr std::size_t DeltaSteppingShortestPaths<EdgeWeightType>::PARALLEL_GRAIN_SIZE;
+
+// Helper method to split [0, count) into one contiguous chunk per thread (of at least grainSize items) and run body(threadIndex, begin, end) on each
+template <typename EdgeWeightType>
+void DeltaSteppingShortestPaths<EdgeWeightType>::parallelFor(std::size_t count, std::size_t grainSize,
+                                                             const std::function<void(unsigned int, std::size_t, std::size_t)>& body) const {
+    unsigned int numChunks = static_cast<unsigned int>(std::min<std::size_t>(this->numThreads, std::max<std::size_t>(count / grainSize, 1)));
+    std::vector<std::thread> threads;
+    for (unsigned int chunkIndex = 1; chunkIndex < numChunks; chunkIndex++) {
+        threads.emplace_back(body, chunkIndex, count * chunkIndex / numChunks, count * (chunkIndex + 1) / numChunks);
+    }
+    body(0, 0, count / numChunks);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Function to find the shortest paths from sourceVertex to every vertex
+template <typename EdgeWeightType>
+ShortestPaths<EdgeWeightType> DeltaSteppingShortestPaths<EdgeWeightType>::search(std::uint32_t sourceVertex, ShortestPathStatistics* statistics) const {
+    const std::uint32_t numberOfVertices = this->graph.getNumberOfVertices();
+    if (sourceVertex >= numberOfVertices) {
+        throw std::out_of_range("Invalid source vertex");
+    }
+    const unsigned int numThreads = this->numThreads;
+    auto getBucket = [this](EdgeWeightType distance) { return static_cast<std::size_t>(distance / this->bucketWidth); };
+
+    ShortestPaths<EdgeWeightType> shortestPaths;
+    std::vector<EdgeWeightType>& distances = shortestPaths.distances;
+    distances.assign(numberOfVertices, std::numeric_limits<EdgeWeightType>::max());
+    shortestPaths.parents.assign(numberOfVertices, ShortestPaths<EdgeWeightType>::NO_PARENT);
+    distances[sourceVertex] = EdgeWeightType();
+    shortestPaths.parents[sourceVertex] = sourceVertex;
+
+    std::vector<std::vector<std::uint32_t>> buckets(this->numberOfBuckets);
+    buckets[0].push_back(sourceVertex);
+    std::size_t pendingEntries = 1;         // The entries in all buckets (including the stale ones)
+
+    // requests[sender][owner] are the requests a thread sends to the owner of the vertices; updatedPerOwner the vertices an owner shortened
+    std::vector<std::vector<std::vector<RelaxationRequest>>> requests(numThreads, std::vector<std::vector<RelaxationRequest>>(numThreads));
+    std::vector<std::vector<std::uint32_t>> updatedPerOwner(numThreads);
+    std::vector<std::size_t> relaxationsPerThread(numThreads), distanceUpdatesPerOwner(numThreads);
+    ShortestPathStatistics searchStatistics;
+
+    // Relax the light or the heavy edges of the vertices, then put the shortened vertices into their buckets
+    auto relaxEdges = [&](const std::vector<std::uint32_t>& vertices, bool isLight) {
+        parallelFor(vertices.size(), PARALLEL_GRAIN_SIZE, [&](unsigned int threadIndex, std::size_t begin, std::size_t end) {
+            std::vector<std::vector<RelaxationRequest>>& sentRequests = requests[threadIndex];
+            std::size_t relaxations = 0;
+            for (std::size_t index = begin; index < end; index++) {
+                const std::uint32_t vertex = vertices[index];
+                for (std::uint32_t edgeIndex = this->graph.offsets[vertex]; edgeIndex < this->graph.offsets[vertex + 1]; edgeIndex++) {
+                    const EdgeWeightType weight = this->graph.weights[edgeIndex];
+                    if ((weight <= this->bucketWidth) != isLight)
+                        continue;
+                    relaxations++;
+                    const std::uint32_t adjacentVertex = this->graph.targets[edgeIndex];
+                    const EdgeWeightType newDistance = distances[vertex] + weight;
+                    if (newDistance < distances[adjacentVertex]) {
+                        sentRequests[adjacentVertex % numThreads].push_back(RelaxationRequest{adjacentVertex, vertex, newDistance});
+                    }
+                }
+            }
+            relaxationsPerThread[threadIndex] = relaxations;
+        });
+
+        std::size_t numberOfRequests = 0;
+        for (unsigned int sender = 0; sender < numThreads; sender++) {
+            for (unsigned int owner = 0; owner < numThreads; owner++) {
+                numberOfRequests += requests[sender][owner].size();
+            }
+        }
+        // Every owner is applied by a single thread; with few requests, all of them by this one
+        const std::size_t ownerGrainSize = (numberOfRequests >= PARALLEL_GRAIN_SIZE) ? 1 : numThreads;
+        parallelFor(numThreads, ownerGrainSize, [&](unsigned int, std::size_t begin, std::size_t end) {
+            for (std::size_t owner = begin; owner < end; owner++) {
+                std::size_t distanceUpdates = 0;
+                for (unsigned int sender = 0; sender < numThreads; sender++) {
+                    for (const RelaxationRequest& request : requests[sender][owner]) {
+                        if (request.distance < distances[request.vertex]) {
+                            distances[request.vertex] = request.distance;
+                            shortestPaths.parents[request.vertex] = request.parentVertex;
+                            updatedPerOwner[owner].push_back(request.vertex);
+                            distanceUpdates++;
+                        }
+                    }
+                    requests[sender][owner].clear();
+                }
+                distanceUpdatesPerOwner[owner] = distanceUpdates;
+            }
+        });
+
+        for (unsigned int threadIndex = 0; threadIndex < numThreads; threadIndex++) {
+            searchStatistics.relaxations += relaxationsPerThread[threadIndex];
+            searchStatistics.distanceUpdates += distanceUpdatesPerOwner[threadIndex];
+            relaxationsPerThread[threadIndex] = distanceUpdatesPerOwner[threadIndex] = 0;
+            for (std::uint32_t vertex : updatedPerOwner[threadIndex]) {
+                buckets[getBucket(distances[vertex]) % this->numberOfBuckets].push_back(vertex);
+                pendingEntries++;
+            }
+            updatedPerOwner[threadIndex].clear();
+        }
+        searchStatistics.phases++;
+    };
+
+    std::vector<std::uint32_t> frontier, settledVertices;
+    std::vector<bool> isInFrontier(numberOfVertices, false), isSettled(numberOfVertices, false);
+    for (std::size_t currentBucket = 0; pendingEntries > 0; currentBucket++) {
+        std::vector<std::uint32_t>& bucket = buckets[currentBucket % this->numberOfBuckets];
+        settledVertices.clear();
+        while (!bucket.empty()) {
+            // Take the bucket as the frontier, skipping the stale entries (the vertices moved to a lower bucket) and the duplicates
+            frontier.clear();
+            for (std::uint32_t vertex : bucket) {
+                if (getBucket(distances[vertex]) == currentBucket && !isInFrontier[vertex]) {
+                    isInFrontier[vertex] = true;
+                    frontier.push_back(vertex);
+                }
+            }
+            pendingEntries -= bucket.size();
+            bucket.clear();
+            for (std::uint32_t vertex : frontier) {
+                isInFrontier[vertex] = false;
+                if (!isSettled[vertex]) {
+                    isSettled[vertex] = true;
+                    settledVertices.push_back(vertex);
+                }
+            }
+            if (!frontier.empty()) {
+                relaxEdges(frontier, true);
+            }
+        }
+        if (!settledVertices.empty()) {
+            relaxEdges(settledVertices, false);
+        }
+    }
+
+    if (statistics != nullptr) {
+        *statistics = searchStatistics;
+    }
+    return shortestPaths;
+}
+
+#endif // SHORTEST_PATHS_HPP
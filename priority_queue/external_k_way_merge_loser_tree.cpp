@@ -0,0 +1,345 @@
+/**
+ * @file external_k_way_merge_loser_tree.cpp
+ * @brief C++ Program to merge k file-backed sorted runs (external memory merge sort) using a loser tree
+ *        A loser tree (tournament tree) keeps the loser of each match at the internal nodes, and the overall winner at the top.
+ *        After the winner is output and replaced by the next element of its run, only the path from its leaf to the root is replayed,
+ *        comparing against the stored losers: exactly one comparison per level, while a binary heap needs two (both children).
+ *        Each run is read in blocks, and the next block is prefetched asynchronously while the current one is being merged,
+ *        and the output is written in the same double-buffered way, so the merge waits for the disk rather than the CPU.
+ *
+ *        Build & Run: g++ -std=c++17 -O2 -pthread external_k_way_merge_loser_tree.cpp -o external_k_way_merge_loser_tree
+ */
+//
+
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <filesystem>
+#include <type_traits>
+
+// A loser tree over k sources; each source supplies its current element (or nothing, once exhausted)
+// tree[0] is the winner (the source with the smallest current element), and tree[1..k-1] are the losers of the internal nodes.
+// The leaf of source i is the (virtual) node k + i, so the parent of a node is node / 2, just like the array heap.
+template <typename LoserTreeElementType, typename Compare = std::less<LoserTreeElementType>>
+class LoserTree {
+private:
+    std::vector<unsigned int> tree;
+    std::vector<LoserTreeElementType> currentElements;  // The current element of each source
+    std::vector<bool> exhausted;                        // Whether each source has no more elements (it loses every match)
+    unsigned int numSources;
+    Compare compare;
+
+    // Whether source1 beats source2 (the smaller element wins, and the lower source index wins a tie to keep the merge stable)
+    bool beats(unsigned int source1, unsigned int source2) const {
+        if (exhausted[source1]) return false;
+        if (exhausted[source2]) return true;
+        if (compare(currentElements[source1], currentElements[source2])) return true;
+        if (compare(currentElements[source2], currentElements[source1])) return false;
+        return source1 < source2;
+    }
+
+public:
+    LoserTree(unsigned int numSources, Compare compare = Compare())
+        : tree(std::max(numSources, 1u)), currentElements(numSources), exhausted(numSources, true), numSources(numSources), compare(compare) {}
+
+    // Method to set the first element of a source before build()
+    void setInitialElement(unsigned int source, const LoserTreeElementType& element) {
+        currentElements[source] = element;
+        exhausted[source] = false;
+    }
+
+    void build();                                                   // Method to play all matches from the leaves (O(k))
+    bool empty() const { return numSources == 0 || exhausted[tree[0]]; }
+    unsigned int getWinnerSource() const { return tree[0]; }
+    const LoserTreeElementType& getWinnerElement() const { return currentElements[tree[0]]; }
+    void replaceWinner(const LoserTreeElementType& nextElement);    // Method to replace the winner with the next element of its source
+    void exhaustWinner();                                           // Method to mark the winner's source as exhausted
+
+private:
+    void replayFromWinner();                                        // Helper method to replay the matches on the path of the winner's leaf
+};
+
+// Method to play all matches from the leaves; each internal node keeps the loser, and the winner goes up
+template <typename LoserTreeElementType, typename Compare>
+void LoserTree<LoserTreeElementType, Compare>::build() {
+    if (numSources <= 1) {
+        tree[0] = 0;
+        return;
+    }
+    std::vector<unsigned int> winners(2 * numSources);
+    for (unsigned int source = 0; source < numSources; source++) {
+        winners[numSources + source] = source;
+    }
+    for (unsigned int node = numSources - 1; node > 0; node--) {
+        unsigned int left = winners[2 * node], right = winners[2 * node + 1];
+        bool leftWins = beats(left, right);
+        winners[node] = leftWins ? left : right;
+        tree[node] = leftWins ? right : left;
+    }
+    tree[0] = winners[1];
+}
+
+// Helper method to replay the matches on the path from the winner's leaf to the root (one comparison per level)
+template <typename LoserTreeElementType, typename Compare>
+void LoserTree<LoserTreeElementType, Compare>::replayFromWinner() {
+    unsigned int winner = tree[0];
+    for (unsigned int node = (numSources + winner) / 2; node > 0; node /= 2) {
+        if (beats(tree[node], winner)) {
+            // The stored loser beats the new candidate, so they swap roles
+            std::swap(tree[node], winner);
+        }
+    }
+    tree[0] = winner;
+}
+
+// Method to replace the winner with the next element of its source
+template <typename LoserTreeElementType, typename Compare>
+void LoserTree<LoserTreeElementType, Compare>::replaceWinner(const LoserTreeElementType& nextElement) {
+    currentElements[tree[0]] = nextElement;
+    replayFromWinner();
+}
+
+// Method to mark the winner's source as exhausted
+template <typename LoserTreeElementType, typename Compare>
+void LoserTree<LoserTreeElementType, Compare>::exhaustWinner() {
+    exhausted[tree[0]] = true;
+    replayFromWinner();
+}
+
+// A buffered reader of a sorted run file (raw binary elements); the next block is prefetched asynchronously
+template <typename RunElementType>
+class RunReader {
+private:
+    std::FILE* file;
+    std::vector<RunElementType> currentBlock, nextBlock;
+    std::size_t currentSize = 0, currentIndex = 0;
+    std::future<std::size_t> prefetch;                  // The pending read of nextBlock
+    std::size_t blockElements;
+
+    void startPrefetch() {
+        prefetch = std::async(std::launch::async, [this]() {
+            return std::fread(nextBlock.data(), sizeof(RunElementType), blockElements, file);
+        });
+    }
+
+public:
+    RunReader(const std::string& fileName, std::size_t blockElements)
+        : currentBlock(blockElements), nextBlock(blockElements), blockElements(blockElements) {
+        static_assert(std::is_trivially_copyable<RunElementType>::value, "Run elements are stored as raw bytes");
+        file = std::fopen(fileName.c_str(), "rb");
+        if (file == nullptr) {
+            throw std::runtime_error("Failed to open the run: " + fileName);
+        }
+        startPrefetch();
+    }
+
+    ~RunReader() {
+        if (prefetch.valid()) prefetch.wait();
+        std::fclose(file);
+    }
+
+    RunReader(const RunReader&) = delete;
+    RunReader& operator=(const RunReader&) = delete;
+
+    // Method to read the next element, returning false at the end of the run
+    bool next(RunElementType& element) {
+        if (currentIndex == currentSize) {
+            if (!prefetch.valid()) {
+                return false;   // The end of the run has already been reached
+            }
+            // Swap in the prefetched block, and start prefetching the one after it right away
+            currentSize = prefetch.get();
+            currentIndex = 0;
+            if (currentSize == 0) {
+                return false;
+            }
+            currentBlock.swap(nextBlock);
+            startPrefetch();
+        }
+        element = currentBlock[currentIndex++];
+        return true;
+    }
+};
+
+// A buffered writer of raw binary elements; a full block is written asynchronously while the other block is being filled
+template <typename RunElementType>
+class RunWriter {
+private:
+    std::FILE* file;
+    std::vector<RunElementType> currentBlock, writingBlock;
+    std::size_t currentSize = 0;
+    std::future<std::size_t> pendingWrite;
+    std::size_t blockElements;
+
+    void flushBlock() {
+        if (pendingWrite.valid() && pendingWrite.get() != writingBlock.size()) {
+            throw std::runtime_error("Failed to write the output");
+        }
+        currentBlock.resize(currentSize);
+        currentBlock.swap(writingBlock);
+        currentBlock.resize(blockElements);
+        currentSize = 0;
+        pendingWrite = std::async(std::launch::async, [this]() {
+            return std::fwrite(writingBlock.data(), sizeof(RunElementType), writingBlock.size(), file);
+        });
+    }
+
+public:
+    RunWriter(const std::string& fileName, std::size_t blockElements) : currentBlock(blockElements), blockElements(blockElements) {
+        file = std::fopen(fileName.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("Failed to open the output: " + fileName);
+        }
+    }
+
+    // Destructor; if close() was not called (e.g. an exception during the merge), the pending block is still written,
+    // but a destructor cannot throw, so only close() reports a write error
+    ~RunWriter() {
+        if (file == nullptr) {
+            return;
+        }
+        try {
+            if (currentSize > 0) {
+                flushBlock();
+            }
+        } catch (const std::exception&) {
+            // The earlier write failed; the output is incomplete either way
+        }
+        if (pendingWrite.valid()) pendingWrite.wait();
+        std::fclose(file);
+    }
+
+    RunWriter(const RunWriter&) = delete;
+    RunWriter& operator=(const RunWriter&) = delete;
+
+    void write(const RunElementType& element) {
+        currentBlock[currentSize++] = element;
+        if (currentSize == blockElements) {
+            flushBlock();
+        }
+    }
+
+    // Method to write the remaining elements, wait for every pending write, and close the file (throwing on any write error)
+    void close() {
+        if (currentSize > 0) {
+            flushBlock();
+        }
+        if (pendingWrite.valid() && pendingWrite.get() != writingBlock.size()) {
+            throw std::runtime_error("Failed to write the output");
+        }
+        if (std::fflush(file) != 0) {
+            throw std::runtime_error("Failed to flush the output");
+        }
+        std::FILE* closingFile = file;
+        file = nullptr;
+        if (std::fclose(closingFile) != 0) {
+            throw std::runtime_error("Failed to close the output");
+        }
+    }
+};
+
+// A function to merge sorted run files into one sorted output file via a loser tree, returning the number of merged elements
+template <typename RunElementType, typename Compare = std::less<RunElementType>>
+std::size_t mergeSortedRuns(const std::vector<std::string>& runFileNames, const std::string& outputFileName,
+                            std::size_t blockElements = 1 << 16, Compare compare = Compare()) {
+    std::vector<std::unique_ptr<RunReader<RunElementType>>> runReaders;
+    LoserTree<RunElementType, Compare> loserTree(static_cast<unsigned int>(runFileNames.size()), compare);
+    for (unsigned int run = 0; run < runFileNames.size(); run++) {
+        runReaders.emplace_back(new RunReader<RunElementType>(runFileNames[run], blockElements));
+        RunElementType firstElement;
+        if (runReaders[run]->next(firstElement)) {
+            loserTree.setInitialElement(run, firstElement);
+        }
+    }
+    loserTree.build();
+
+    RunWriter<RunElementType> runWriter(outputFileName, blockElements);
+    std::size_t numMergedElements = 0;
+    while (!loserTree.empty()) {
+        runWriter.write(loserTree.getWinnerElement());
+        numMergedElements++;
+
+        RunElementType nextElement;
+        if (runReaders[loserTree.getWinnerSource()]->next(nextElement)) {
+            loserTree.replaceWinner(nextElement);
+        } else {
+            loserTree.exhaustWinner();
+        }
+    }
+    runWriter.close();
+    return numMergedElements;
+}
+
+// A helper function to split the input elements into sorted runs of at most runElements elements each (the first phase of the external sort)
+template <typename RunElementType>
+std::vector<std::string> writeSortedRuns(const std::vector<RunElementType>& elements, std::size_t runElements, const std::string& runFilePrefix) {
+    std::vector<std::string> runFileNames;
+    for (std::size_t begin = 0; begin < elements.size(); begin += runElements) {
+        std::size_t end = std::min(begin + runElements, elements.size());
+        std::vector<RunElementType> run(elements.begin() + begin, elements.begin() + end);
+        std::sort(run.begin(), run.end());
+
+        std::string runFileName = runFilePrefix + std::to_string(runFileNames.size()) + ".bin";
+        RunWriter<RunElementType> runWriter(runFileName, 1 << 16);
+        for (const RunElementType& element : run) {
+            runWriter.write(element);
+        }
+        runWriter.close();
+        runFileNames.push_back(runFileName);
+    }
+    return runFileNames;
+}
+
+int main(void) {
+    // 8M random 64-bit keys (64MB), split into 16 sorted runs
+    const std::size_t numElements = 8u << 20;
+    const std::size_t runElements = 512u << 10;
+    std::mt19937_64 randomEngine(7);
+    std::vector<std::uint64_t> elements(numElements);
+    for (std::uint64_t& element : elements) {
+        element = randomEngine();
+    }
+
+    std::string runFilePrefix = (std::filesystem::temp_directory_path() / "loser_tree_run_").string();
+    std::string outputFileName = (std::filesystem::temp_directory_path() / "loser_tree_merged.bin").string();
+    std::vector<std::string> runFileNames = writeSortedRuns(elements, runElements, runFilePrefix);
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::size_t numMergedElements = mergeSortedRuns<std::uint64_t>(runFileNames, outputFileName);
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Verify the merged output against the in-memory sort
+    std::sort(elements.begin(), elements.end());
+    std::vector<std::uint64_t> mergedElements(numElements);
+    std::FILE* mergedFile = std::fopen(outputFileName.c_str(), "rb");
+    if (mergedFile == nullptr) {
+        std::cerr << "Failed to open the merged output: " << outputFileName << std::endl;
+        return 1;
+    }
+    std::size_t numReadElements = std::fread(mergedElements.data(), sizeof(std::uint64_t), numElements, mergedFile);
+    std::fclose(mergedFile);
+
+    std::cout << "Runs: " << runFileNames.size() << ", merged elements: " << numMergedElements << std::endl;
+    std::cout << "Sorted correctly: " << ((numReadElements == numElements && mergedElements == elements) ? "yes" : "no") << std::endl;
+    std::cout << "Merge throughput: " << (numElements * sizeof(std::uint64_t) / (1024.0 * 1024.0)) / elapsedSeconds << " MB/s" << std::endl;
+
+    for (const std::string& runFileName : runFileNames) {
+        std::remove(runFileName.c_str());
+    }
+    std::remove(outputFileName.c_str());
+
+    return 0;
+}
+
+// Runs: 16, merged elements: 8388608
+// Sorted correctly: yes
+// Merge throughput: 128.627 MB/s (varies by machine and disk)
@@ -1,108 +1,15 @@
 /**
  * @file huffman_code.cpp
  * @brief Huffman Code algorithm (string encoding/decoding) implementation using a priority queue
+ *        The implementation itself lives in huffman_code.hpp (generic over the symbol type), so that it can be benchmarked as well.
  */
 
 #include <iostream>
-#include <queue>
 #include <map>
 #include <vector>
-#include <memory>
 #include <string>
-
-// Define the node structure for the Huffman tree
-struct HuffmanNode {
-    char character;                         // The character stored in the node
-    unsigned int frequency;                 // The frequency(occurrence of appearance in the given std::stirng text) of the character
-    std::shared_ptr<HuffmanNode> left;      // Pointer to the left child node
-    std::shared_ptr<HuffmanNode> right;     // Pointer to the right child node
-
-    // Constructor
-    HuffmanNode(char character, unsigned int frequency) 
-        : character(character), frequency(frequency), left(nullptr), right(nullptr) {}
-
-    // Comparison operator for the priority queue (min heap)
-    bool operator>(const HuffmanNode& other) const {
-        return frequency > other.frequency;
-    }
-
-    // With using the overloaded operator, we can compare the HuffmanNode objects in the priority queue (for std::priority_queue<HuffmanNode>)
-    struct Compare {
-        bool operator()(const std::shared_ptr<HuffmanNode>& a, const std::shared_ptr<HuffmanNode>& b) const {
-            return *a > *b;
-        }
-    };
-};
-
-// A function to build the Huffman tree
-// Suppose we have "abracadabra" as an input string, then the characterOccurrenceFrequencies will be like:
-// [a: 5, b: 2, r: 2, c: 1, d: 1]
-// The Huffman tree will be like:
-//              [11]
-//        ----------------
-//        |              |
-//     [5: a]           [6]
-//                   ---------
-//                   |       |
-//                  [2]     [4]
-//                -----     -----------
-//                |   |     |         |
-//            [1: c] [1: d] [2: b] [2: r]
-// Right branch is 1, left branch is 0 (Vice versa is also possible. Note that generateHuffmanCodes function)
-// For example, "c" is reached "(root) -> right -> left -> left -> (c)", so encoded as "100"
-
-std::shared_ptr<HuffmanNode> buildHuffmanTree(const std::map<char, unsigned int>& characterOccurrenceFrequencies) {
-    // Build a priority queue to store the nodes of the Huffman tree in ascending order of frequencies
-    //  - 1st parameter: type of the elements in the priority queue
-    //  - 2nd parameter: container type to be used (default is std::vector)
-    //  - 3rd parameter: comparison function to sort the elements in the priority queue
-    std::priority_queue<std::shared_ptr<HuffmanNode>, std::vector<std::shared_ptr<HuffmanNode>>, HuffmanNode::Compare> huffmanPriorityQueue;
-
-    // Push the nodes of the Huffman tree to the priority queue    
-    for (const auto& characterOccurrenceFrequency : characterOccurrenceFrequencies) {
-        huffmanPriorityQueue.push(std::make_shared<HuffmanNode>(characterOccurrenceFrequency.first, characterOccurrenceFrequency.second));
-    }
-
-    while (huffmanPriorityQueue.size() > 1) {
-        // EXtract two lowest frequency nodes from the priority queue
-        std::shared_ptr<HuffmanNode> leftNode = huffmanPriorityQueue.top(); huffmanPriorityQueue.pop();
-        std::shared_ptr<HuffmanNode> rightNode = huffmanPriorityQueue.top(); huffmanPriorityQueue.pop();
-
-        // Create a parent node with the sum of the frequencies of the left and right nodes
-        std::shared_ptr<HuffmanNode> parentNode = std::make_shared<HuffmanNode>('\0', leftNode->frequency + rightNode->frequency);
-        parentNode->left = leftNode;
-        parentNode->right = rightNode;
-
-        // The new parent node is pushed back to the priority queue
-        huffmanPriorityQueue.push(parentNode);
-    }
-
-    return huffmanPriorityQueue.top();
-}
-
-// A function to generate the Huffman codes for each character
-void generateHuffmanCodes(const std::shared_ptr<HuffmanNode>& root, std::map<char, std::string>& huffmanCodes, std::string code = "") {
-    if (!root->left && !root->right) {
-        huffmanCodes[root->character] = code;
-    } else {
-        generateHuffmanCodes(root->left, huffmanCodes, code + "0");
-        generateHuffmanCodes(root->right, huffmanCodes, code + "1");
-    }
-}
-
-// A function to decode the Huffman encoded string
-std::string decodeHuffmanCode(const std::shared_ptr<HuffmanNode>& root, const std::string& encodedString) {
-    std::string decodedString;
-    auto currentNode = root;
-    for (char bit : encodedString) {
-        currentNode = (bit == '0') ? currentNode->left : currentNode->right;
-        if (!currentNode->left && !currentNode->right) {
-            decodedString += currentNode->character;
-            currentNode = root;
-        }
-    }
-    return decodedString;
-}
+#include <cstdint>
+#include "huffman_code.hpp"
 
 int main() {
     std::string inputString = "abracadabra";
@@ -134,9 +41,59 @@ int main() {
     std::cout << "Encoded String: " << encodedString << std::endl;
 
     // Decode the encoded string
-    std::string decodedString = decodeHuffmanCode(huffmanTreeRoot, encodedString);
+    std::vector<char> decodedCharacters = decodeHuffmanCode(huffmanTreeRoot, encodedString);
+    std::string decodedString(decodedCharacters.begin(), decodedCharacters.end());
     std::cout << "Decoded String: " << decodedString << std::endl;
 
+    // Build the Huffman code lengths directly (without the tree) via the two-queue method
+    std::map<char, unsigned int> huffmanCodeLengths = buildHuffmanCodeLengthsTwoQueue(characterOccurrenceFrequencies);
+    std::cout << "Huffman Code Lengths (two-queue):" << std::endl;
+    for (const auto& huffmanCodeLength : huffmanCodeLengths) {
+        std::cout << huffmanCodeLength.first << ": " << huffmanCodeLength.second << std::endl;
+    }
+
+    // Canonical Huffman codes over 8-bit symbols, with packed bytes and table-driven decoding
+    std::vector<char> inputCharacters(inputString.begin(), inputString.end());
+    CanonicalHuffmanCodec<char> characterCodec(countSymbolFrequencies(inputCharacters));
+    std::cout << "Canonical Huffman Codes:" << std::endl;
+    for (const auto& huffmanCodeLength : huffmanCodeLengths) {
+        std::cout << huffmanCodeLength.first << ": " << characterCodec.getCodeString(huffmanCodeLength.first) << std::endl;
+    }
+    std::size_t encodedBitLength = 0;
+    std::vector<std::uint8_t> encodedBytes = characterCodec.encode(inputCharacters, encodedBitLength);
+    std::vector<char> canonicalDecodedCharacters = characterCodec.decode(encodedBytes, inputCharacters.size());
+    std::cout << "Canonical Encoded Bits: " << encodedBitLength << " (" << encodedBytes.size() << " bytes)" << std::endl;
+    std::cout << "Canonical Decoded String: " << std::string(canonicalDecodedCharacters.begin(), canonicalDecodedCharacters.end()) << std::endl;
+
+    // 16-bit byte-pair symbols; repetitive text such as structured logs has far fewer distinct pairs than the 65536 possible ones,
+    // so one code often stands for two bytes at once
+    std::string logText;
+    for (int line = 0; line < 8; line++) {
+        logText += "level=info msg=ok code=200\n";
+    }
+    std::vector<char> logCharacters(logText.begin(), logText.end());
+    std::vector<std::uint16_t> logBytePairs = packBytePairs(logText);
+
+    CanonicalHuffmanCodec<char> byteCodec(countSymbolFrequencies(logCharacters));
+    CanonicalHuffmanCodec<std::uint16_t> bytePairCodec(countSymbolFrequencies(logBytePairs));
+
+    // A decoder needs the code lengths as well, so the serialized table counts towards the compressed size;
+    // the 16-bit table is the bigger one, as it spans a larger alphabet
+    std::size_t byteEncodedBitLength = 0, bytePairEncodedBitLength = 0;
+    std::vector<std::uint8_t> byteEncodedBytes = byteCodec.encode(logCharacters, byteEncodedBitLength);
+    std::vector<std::uint8_t> bytePairEncodedBytes = bytePairCodec.encode(logBytePairs, bytePairEncodedBitLength);
+    std::vector<std::uint8_t> byteCodeLengths = byteCodec.serializeCodeLengths();
+    std::vector<std::uint8_t> bytePairCodeLengths = bytePairCodec.serializeCodeLengths();
+    CanonicalHuffmanCodec<std::uint16_t> bytePairDecoder = CanonicalHuffmanCodec<std::uint16_t>::fromSerializedCodeLengths(bytePairCodeLengths);
+    std::string bytePairDecodedText = unpackBytePairs(bytePairDecoder.decode(bytePairEncodedBytes, logBytePairs.size()), logText.size());
+
+    std::cout << "Log Text Bytes: " << logText.size() << std::endl;
+    std::cout << "8-bit Symbols Encoded Bits: " << byteEncodedBitLength << " (" << byteEncodedBytes.size() << " bytes + "
+              << byteCodeLengths.size() << " table bytes = " << byteEncodedBytes.size() + byteCodeLengths.size() << " bytes)" << std::endl;
+    std::cout << "16-bit Symbols Encoded Bits: " << bytePairEncodedBitLength << " (" << bytePairEncodedBytes.size() << " bytes + "
+              << bytePairCodeLengths.size() << " table bytes = " << bytePairEncodedBytes.size() + bytePairCodeLengths.size() << " bytes)" << std::endl;
+    std::cout << "16-bit Symbols Decoded Correctly: " << (bytePairDecodedText == logText ? "yes" : "no") << std::endl;
+
     return 0;
 }
 
@@ -147,4 +104,23 @@ int main() {
 // d: 101
 // r: 111
 // Encoded String: 01101110100010101101110
-// Decoded String: abracadabra
\ No newline at end of file
+// Decoded String: abracadabra
+// Huffman Code Lengths (two-queue):
+// a: 1
+// b: 3
+// c: 3
+// d: 3
+// r: 3
+// Canonical Huffman Codes:
+// a: 0
+// b: 100
+// c: 101
+// d: 110
+// r: 111
+// Canonical Encoded Bits: 23 (3 bytes)
+// Canonical Decoded String: abracadabra
+// Log Text Bytes: 216
+// 8-bit Symbols Encoded Bits: 872 (109 bytes + 38 table bytes = 147 bytes)
+// 16-bit Symbols Encoded Bits: 520 (65 bytes + 99 table bytes = 164 bytes)
+// 16-bit Symbols Decoded Correctly: yes
+// (On a text this short, the bigger 16-bit table outweighs the shorter encoded bits)
\ No newline at end of file
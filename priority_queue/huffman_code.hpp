@@ -0,0 +1,566 @@
+/**
+ * @file huffman_code.hpp
+ * @brief Huffman Code algorithm (string encoding/decoding) implementation using a priority queue
+ *        The implementation is generic over the symbol type, so not only 8-bit characters(char)
+ *        but also 16-bit symbols(std::uint16_t, e.g. byte pairs or a tokenized alphabet) can be encoded.
+ *        It is shared by huffman_code.cpp (example) and huffman_code_benchmark.cpp (benchmark).
+ */
+
+#ifndef HUFFMAN_CODE_HPP
+#define HUFFMAN_CODE_HPP
+
+#include <queue>
+#include <map>
+#include <vector>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <stdexcept>
+#include <cassert>
+
+// Define the node structure for the Huffman tree
+template <typename HuffmanSymbolType>
+struct HuffmanNode {
+    HuffmanSymbolType symbol;               // The symbol(character, byte pair, token, etc.) stored in the node
+    unsigned int frequency;                 // The frequency(occurrence of appearance in the given text) of the symbol
+    std::shared_ptr<HuffmanNode> left;      // Pointer to the left child node
+    std::shared_ptr<HuffmanNode> right;     // Pointer to the right child node
+
+    // Constructor
+    HuffmanNode(HuffmanSymbolType symbol, unsigned int frequency)
+        : symbol(symbol), frequency(frequency), left(nullptr), right(nullptr) {}
+
+    // Comparison operator for the priority queue (min heap)
+    bool operator>(const HuffmanNode& other) const {
+        return frequency > other.frequency;
+    }
+
+    // With using the overloaded operator, we can compare the HuffmanNode objects in the priority queue (for std::priority_queue<HuffmanNode>)
+    struct Compare {
+        bool operator()(const std::shared_ptr<HuffmanNode>& a, const std::shared_ptr<HuffmanNode>& b) const {
+            return *a > *b;
+        }
+    };
+};
+
+// A function to build the Huffman tree
+// Suppose we have "abracadabra" as an input string, then the symbolOccurrenceFrequencies will be like:
+// [a: 5, b: 2, r: 2, c: 1, d: 1]
+// The Huffman tree will be like:
+//              [11]
+//        ----------------
+//        |              |
+//     [5: a]           [6]
+//                   ---------
+//                   |       |
+//                  [2]     [4]
+//                -----     -----------
+//                |   |     |         |
+//            [1: c] [1: d] [2: b] [2: r]
+// Right branch is 1, left branch is 0 (Vice versa is also possible. Note that generateHuffmanCodes function)
+// For example, "c" is reached "(root) -> right -> left -> left -> (c)", so encoded as "100"
+template <typename HuffmanSymbolType>
+std::shared_ptr<HuffmanNode<HuffmanSymbolType>> buildHuffmanTree(const std::map<HuffmanSymbolType, unsigned int>& symbolOccurrenceFrequencies) {
+    using HuffmanNodePointer = std::shared_ptr<HuffmanNode<HuffmanSymbolType>>;
+
+    // Build a priority queue to store the nodes of the Huffman tree in ascending order of frequencies
+    //  - 1st parameter: type of the elements in the priority queue
+    //  - 2nd parameter: container type to be used (default is std::vector)
+    //  - 3rd parameter: comparison function to sort the elements in the priority queue
+    std::priority_queue<HuffmanNodePointer, std::vector<HuffmanNodePointer>, typename HuffmanNode<HuffmanSymbolType>::Compare> huffmanPriorityQueue;
+
+    // Push the nodes of the Huffman tree to the priority queue
+    for (const auto& symbolOccurrenceFrequency : symbolOccurrenceFrequencies) {
+        huffmanPriorityQueue.push(std::make_shared<HuffmanNode<HuffmanSymbolType>>(symbolOccurrenceFrequency.first, symbolOccurrenceFrequency.second));
+    }
+
+    while (huffmanPriorityQueue.size() > 1) {
+        // EXtract two lowest frequency nodes from the priority queue
+        HuffmanNodePointer leftNode = huffmanPriorityQueue.top(); huffmanPriorityQueue.pop();
+        HuffmanNodePointer rightNode = huffmanPriorityQueue.top(); huffmanPriorityQueue.pop();
+
+        // Create a parent node with the sum of the frequencies of the left and right nodes
+        HuffmanNodePointer parentNode = std::make_shared<HuffmanNode<HuffmanSymbolType>>(HuffmanSymbolType(), leftNode->frequency + rightNode->frequency);
+        parentNode->left = leftNode;
+        parentNode->right = rightNode;
+
+        // The new parent node is pushed back to the priority queue
+        huffmanPriorityQueue.push(parentNode);
+    }
+
+    return huffmanPriorityQueue.top();
+}
+
+// A helper function computing the Huffman code lengths in linear time via the two-queue method
+// Instead of a priority queue of shared pointers, every node lives in one flat array:
+//  - indices [0, n) are the leaves sorted in ascending order of frequencies (1st queue)
+//  - indices [n, 2n - 1) are the internal nodes, created in non-decreasing order of frequencies (2nd queue)
+// Since both queues are already sorted, the two lowest frequency nodes are always at the front of one of them,
+// so each merge step is O(1) and the whole construction is O(n) after sorting. (O(n log n) only for the sort itself)
+// The tree is never materialized; only the parent index of each node is kept, and the code length of a leaf
+// is simply its depth, which is resolved from the root downwards because a parent index is always larger than its children's.
+// The returned code lengths are in the same order as the given (sorted) frequencies.
+inline std::vector<unsigned int> computeHuffmanCodeLengthsOfSortedFrequencies(const std::vector<unsigned long long>& sortedFrequencies) {
+    const std::size_t numberOfLeaves = sortedFrequencies.size();
+    if (numberOfLeaves == 0) {
+        return {};
+    }
+    if (numberOfLeaves == 1) {
+        // A single symbol still needs one bit to be encoded
+        return {1};
+    }
+
+    // Flat node array; leaves first, then internal nodes
+    const std::size_t numberOfNodes = 2 * numberOfLeaves - 1;
+    std::vector<unsigned long long> nodeFrequencies(numberOfNodes);
+    std::vector<std::size_t> nodeParents(numberOfNodes, 0);
+    std::copy(sortedFrequencies.begin(), sortedFrequencies.end(), nodeFrequencies.begin());
+
+    std::size_t leafFront = 0;                      // Front of the 1st queue (leaves)
+    std::size_t internalFront = numberOfLeaves;     // Front of the 2nd queue (internal nodes)
+
+    // Take the lowest frequency node among the fronts of the two queues
+    // On a tie, the leaf is preferred so that the longest code length stays as short as possible
+    auto popLowestFrequencyNode = [&](std::size_t internalBack) {
+        if (leafFront < numberOfLeaves &&
+            (internalFront == internalBack || nodeFrequencies[leafFront] <= nodeFrequencies[internalFront])) {
+            return leafFront++;
+        }
+        return internalFront++;
+    };
+
+    for (std::size_t parentIndex = numberOfLeaves; parentIndex < numberOfNodes; parentIndex++) {
+        // Extract two lowest frequency nodes, and merge them into the next internal node (back of the 2nd queue)
+        std::size_t leftIndex = popLowestFrequencyNode(parentIndex);
+        std::size_t rightIndex = popLowestFrequencyNode(parentIndex);
+        nodeFrequencies[parentIndex] = nodeFrequencies[leftIndex] + nodeFrequencies[rightIndex];
+        nodeParents[leftIndex] = parentIndex;
+        nodeParents[rightIndex] = parentIndex;
+    }
+
+    // Resolve the depths from the root (the last node) downwards, reusing the frequency array as the depth array
+    std::vector<unsigned long long>& nodeDepths = nodeFrequencies;
+    nodeDepths[numberOfNodes - 1] = 0;
+    for (std::size_t index = numberOfNodes - 1; index-- > 0;) {
+        nodeDepths[index] = nodeDepths[nodeParents[index]] + 1;
+    }
+
+    return std::vector<unsigned int>(nodeDepths.begin(), nodeDepths.begin() + numberOfLeaves);
+}
+
+// A function to build the Huffman code lengths in linear time via the two-queue method (see the helper above)
+// For "abracadabra", it yields [a: 1, b: 3, c: 3, d: 3, r: 3], which is the same as the depths of the tree above.
+template <typename HuffmanSymbolType>
+std::map<HuffmanSymbolType, unsigned int> buildHuffmanCodeLengthsTwoQueue(const std::map<HuffmanSymbolType, unsigned int>& symbolOccurrenceFrequencies) {
+    // Sort the leaves in ascending order of frequencies (1st queue)
+    std::vector<std::pair<unsigned int, HuffmanSymbolType>> sortedLeaves;
+    sortedLeaves.reserve(symbolOccurrenceFrequencies.size());
+    for (const auto& symbolOccurrenceFrequency : symbolOccurrenceFrequencies) {
+        sortedLeaves.push_back({symbolOccurrenceFrequency.second, symbolOccurrenceFrequency.first});
+    }
+    std::sort(sortedLeaves.begin(), sortedLeaves.end());
+
+    std::vector<unsigned long long> sortedFrequencies;
+    sortedFrequencies.reserve(sortedLeaves.size());
+    for (const auto& sortedLeaf : sortedLeaves) {
+        sortedFrequencies.push_back(sortedLeaf.first);
+    }
+    std::vector<unsigned int> codeLengths = computeHuffmanCodeLengthsOfSortedFrequencies(sortedFrequencies);
+
+    std::map<HuffmanSymbolType, unsigned int> huffmanCodeLengths;
+    for (std::size_t index = 0; index < sortedLeaves.size(); index++) {
+        huffmanCodeLengths[sortedLeaves[index].second] = codeLengths[index];
+    }
+    return huffmanCodeLengths;
+}
+
+// A function to generate the Huffman codes for each symbol
+template <typename HuffmanSymbolType>
+void generateHuffmanCodes(const std::shared_ptr<HuffmanNode<HuffmanSymbolType>>& root, std::map<HuffmanSymbolType, std::string>& huffmanCodes, std::string code = "") {
+    if (!root->left && !root->right) {
+        huffmanCodes[root->symbol] = code;
+    } else {
+        generateHuffmanCodes(root->left, huffmanCodes, code + "0");
+        generateHuffmanCodes(root->right, huffmanCodes, code + "1");
+    }
+}
+
+// A function to decode the Huffman encoded string
+template <typename HuffmanSymbolType>
+std::vector<HuffmanSymbolType> decodeHuffmanCode(const std::shared_ptr<HuffmanNode<HuffmanSymbolType>>& root, const std::string& encodedString) {
+    std::vector<HuffmanSymbolType> decodedSymbols;
+    auto currentNode = root;
+    for (char bit : encodedString) {
+        currentNode = (bit == '0') ? currentNode->left : currentNode->right;
+        if (!currentNode->left && !currentNode->right) {
+            decodedSymbols.push_back(currentNode->symbol);
+            currentNode = root;
+        }
+    }
+    return decodedSymbols;
+}
+
+// A function to count the frequency of each symbol into a dense frequency table
+// The table is sized to match the alphabet of the symbol type: 256 entries for 8-bit symbols, 65536 entries for 16-bit symbols.
+// The index of the table is the (unsigned) value of the symbol, so no map lookup is needed while counting.
+template <typename HuffmanSymbolType>
+std::vector<unsigned int> countSymbolFrequencies(const std::vector<HuffmanSymbolType>& symbols) {
+    static_assert(std::is_integral<HuffmanSymbolType>::value && sizeof(HuffmanSymbolType) <= 2,
+                  "The dense frequency table only supports 8-bit or 16-bit integral symbols");
+    using UnsignedSymbolType = typename std::make_unsigned<HuffmanSymbolType>::type;
+
+    std::vector<unsigned int> symbolFrequencyTable(std::size_t(std::numeric_limits<UnsignedSymbolType>::max()) + 1, 0);
+    for (HuffmanSymbolType symbol : symbols) {
+        symbolFrequencyTable[static_cast<UnsignedSymbolType>(symbol)]++;
+    }
+    return symbolFrequencyTable;
+}
+
+// A helper function to pack a byte string into 16-bit byte-pair symbols ("ab" -> 0x6162)
+// If the length of the string is odd, the last byte is paired with '\0'. (So, the original length is needed to unpack it)
+inline std::vector<std::uint16_t> packBytePairs(const std::string& text) {
+    std::vector<std::uint16_t> bytePairs;
+    bytePairs.reserve((text.size() + 1) / 2);
+    for (std::size_t index = 0; index < text.size(); index += 2) {
+        std::uint16_t highByte = static_cast<unsigned char>(text[index]);
+        std::uint16_t lowByte = (index + 1 < text.size()) ? static_cast<unsigned char>(text[index + 1]) : 0;
+        bytePairs.push_back(static_cast<std::uint16_t>((highByte << 8) | lowByte));
+    }
+    return bytePairs;
+}
+
+// A helper function to unpack 16-bit byte-pair symbols back into the original byte string
+inline std::string unpackBytePairs(const std::vector<std::uint16_t>& bytePairs, std::size_t originalLength) {
+    std::string text;
+    text.reserve(bytePairs.size() * 2);
+    for (std::uint16_t bytePair : bytePairs) {
+        text += static_cast<char>(bytePair >> 8);
+        text += static_cast<char>(bytePair & 0xFF);
+    }
+    text.resize(originalLength);
+    return text;
+}
+
+// A canonical Huffman codec over a dense frequency table (see countSymbolFrequencies)
+// Only the code lengths are derived from the frequencies (via the two-queue method), and the codes themselves are assigned canonically:
+// shorter codes come first, and the codes of the same length are consecutive numbers in ascending order of symbols.
+// Thanks to that, the encoded bits are packed into bytes, and the decoding is table-driven instead of walking the tree bit by bit.
+//  - codes up to LOOKUP_BITS bits long are resolved by a single lookup of the next LOOKUP_BITS bits
+//  - longer codes (rare by definition) fall back to the per-length canonical tables (firstCode/numberOfCodes/firstSymbolIndex)
+// The code lengths alone define the codes, so they are all a decoder needs along with the encoded bytes (serializeCodeLengths);
+// the lengths are stored in symbol order, a byte per appearing symbol, and every run of absent symbols as a 0 byte and the run length
+// (LEB128, 7 bits per byte). The trailing run is left out, so a sparse 16-bit alphabet does not cost a byte per possible symbol.
+template <typename HuffmanSymbolType>
+class CanonicalHuffmanCodec {
+private:
+    using UnsignedSymbolType = typename std::make_unsigned<HuffmanSymbolType>::type;
+    static constexpr unsigned int LOOKUP_BITS = 11;
+    // encode and decode keep up to 7 leftover bits in a 64-bit buffer, so a code may take the other 57 bits at most
+    static constexpr unsigned int MAX_CODE_LENGTH = 57;
+
+    // An entry of the lookup table; codeLength is 0 if the code is longer than LOOKUP_BITS bits
+    struct LookupEntry {
+        UnsignedSymbolType symbol;
+        unsigned char codeLength;
+    };
+
+    std::vector<unsigned char> codeLengths;             // Code length of each symbol (0 means the symbol never appears)
+    std::vector<std::uint64_t> codes;                   // Canonical code of each symbol
+    unsigned int maxCodeLength = 0;
+    unsigned int lookupBits = 0;                        // min(maxCodeLength, LOOKUP_BITS)
+
+    std::vector<std::uint64_t> firstCode;               // The first (smallest) code of each code length
+    std::vector<unsigned int> numberOfCodes;            // The number of codes of each code length
+    std::vector<unsigned int> firstSymbolIndex;         // The index of sortedSymbols where the codes of each code length start
+    std::vector<UnsignedSymbolType> sortedSymbols;      // Symbols sorted by (code length, symbol)
+    std::vector<LookupEntry> lookupTable;
+
+    CanonicalHuffmanCodec() = default;
+    void buildCodeTables();                             // Helper method to assign the canonical codes and the decoding tables from codeLengths
+
+public:
+    CanonicalHuffmanCodec(const std::vector<unsigned int>& symbolFrequencyTable);
+    static CanonicalHuffmanCodec fromSerializedCodeLengths(const std::vector<std::uint8_t>& serializedCodeLengths);
+
+    unsigned int getCodeLength(HuffmanSymbolType symbol) const { return codeLengths[static_cast<UnsignedSymbolType>(symbol)]; }
+    std::string getCodeString(HuffmanSymbolType symbol) const;
+    std::vector<std::uint8_t> encode(const std::vector<HuffmanSymbolType>& symbols, std::size_t& encodedBitLength) const;
+    std::vector<HuffmanSymbolType> decode(const std::vector<std::uint8_t>& encodedBytes, std::size_t numberOfSymbols) const;
+    std::vector<std::uint8_t> serializeCodeLengths() const;
+};
+
+// Constructor; derive the code lengths, assign the canonical codes, and build the decoding tables
+template <typename HuffmanSymbolType>
+CanonicalHuffmanCodec<HuffmanSymbolType>::CanonicalHuffmanCodec(const std::vector<unsigned int>& symbolFrequencyTable) {
+    static_assert(std::is_integral<HuffmanSymbolType>::value && sizeof(HuffmanSymbolType) <= 2,
+                  "The canonical Huffman codec only supports 8-bit or 16-bit integral symbols");
+    const std::size_t alphabetSize = std::size_t(std::numeric_limits<UnsignedSymbolType>::max()) + 1;
+    if (symbolFrequencyTable.size() != alphabetSize) {
+        throw std::invalid_argument("The frequency table does not match the alphabet size of the symbol type");
+    }
+
+    // Sort the appearing symbols in ascending order of frequencies, then compute the code lengths in linear time
+    std::vector<std::pair<unsigned int, std::size_t>> sortedLeaves;
+    for (std::size_t symbol = 0; symbol < alphabetSize; symbol++) {
+        if (symbolFrequencyTable[symbol] > 0) {
+            sortedLeaves.push_back({symbolFrequencyTable[symbol], symbol});
+        }
+    }
+    std::sort(sortedLeaves.begin(), sortedLeaves.end());
+
+    std::vector<unsigned long long> sortedFrequencies;
+    sortedFrequencies.reserve(sortedLeaves.size());
+    for (const auto& sortedLeaf : sortedLeaves) {
+        sortedFrequencies.push_back(sortedLeaf.first);
+    }
+    std::vector<unsigned int> sortedCodeLengths = computeHuffmanCodeLengthsOfSortedFrequencies(sortedFrequencies);
+
+    this->codeLengths.assign(alphabetSize, 0);
+    for (std::size_t index = 0; index < sortedLeaves.size(); index++) {
+        this->codeLengths[sortedLeaves[index].second] = static_cast<unsigned char>(sortedCodeLengths[index]);
+    }
+    buildCodeTables();
+}
+
+// Factory method to rebuild a codec (for decoding) from the code lengths written by serializeCodeLengths
+template <typename HuffmanSymbolType>
+CanonicalHuffmanCodec<HuffmanSymbolType> CanonicalHuffmanCodec<HuffmanSymbolType>::fromSerializedCodeLengths(const std::vector<std::uint8_t>& serializedCodeLengths) {
+    const std::size_t alphabetSize = std::size_t(std::numeric_limits<UnsignedSymbolType>::max()) + 1;
+    CanonicalHuffmanCodec codec;
+    codec.codeLengths.assign(alphabetSize, 0);
+
+    std::size_t symbol = 0;
+    for (std::size_t byteIndex = 0; byteIndex < serializedCodeLengths.size(); byteIndex++) {
+        std::uint8_t codeLength = serializedCodeLengths[byteIndex];
+        if (codeLength > 0) {
+            if (codeLength > MAX_CODE_LENGTH || symbol >= alphabetSize) {
+                throw std::invalid_argument("Invalid serialized code lengths");
+            }
+            codec.codeLengths[symbol++] = codeLength;
+            continue;
+        }
+
+        // A run of absent symbols; the run length follows in LEB128
+        std::size_t runLength = 0;
+        unsigned int shift = 0;
+        std::uint8_t runByte = 0x80;
+        while (runByte & 0x80) {
+            if (++byteIndex >= serializedCodeLengths.size() || shift > 28) {
+                throw std::invalid_argument("Invalid serialized code lengths");
+            }
+            runByte = serializedCodeLengths[byteIndex];
+            runLength |= std::size_t(runByte & 0x7F) << shift;
+            shift += 7;
+        }
+        if (runLength == 0 || runLength > alphabetSize - symbol) {
+            throw std::invalid_argument("Invalid serialized code lengths");
+        }
+        symbol += runLength;
+    }
+
+    // The lengths must satisfy the Kraft inequality (sum of 2^-length <= 1), or some codes would collide
+    std::vector<unsigned int> lengthCounts(MAX_CODE_LENGTH + 1, 0);
+    for (unsigned char codeLength : codec.codeLengths) {
+        lengthCounts[codeLength]++;
+    }
+    unsigned long long availableCodes = 1;
+    for (unsigned int codeLength = 1; codeLength <= MAX_CODE_LENGTH; codeLength++) {
+        availableCodes *= 2;
+        if (lengthCounts[codeLength] > availableCodes) {
+            throw std::invalid_argument("Invalid serialized code lengths");
+        }
+        availableCodes -= lengthCounts[codeLength];
+        if (availableCodes > alphabetSize) {
+            availableCodes = alphabetSize;      // Plenty of codes are left for every remaining symbol; keep the count from overflowing
+        }
+    }
+    codec.buildCodeTables();
+    return codec;
+}
+
+// Helper method to assign the canonical codes and build the decoding tables from codeLengths
+template <typename HuffmanSymbolType>
+void CanonicalHuffmanCodec<HuffmanSymbolType>::buildCodeTables() {
+    const std::size_t alphabetSize = this->codeLengths.size();
+    std::size_t numberOfSymbols = 0;
+    this->codes.assign(alphabetSize, 0);
+    for (std::size_t symbol = 0; symbol < alphabetSize; symbol++) {
+        if (this->codeLengths[symbol] > 0) {
+            numberOfSymbols++;
+            this->maxCodeLength = std::max<unsigned int>(this->maxCodeLength, this->codeLengths[symbol]);
+        }
+    }
+    // The serialized lengths are checked on parsing; the derived ones stay far below (a code of length L needs a total frequency of about phi^L)
+    assert(this->maxCodeLength <= MAX_CODE_LENGTH);
+    this->lookupBits = (this->maxCodeLength < LOOKUP_BITS) ? this->maxCodeLength : LOOKUP_BITS;
+
+    // Count the codes of each length, and sort the symbols by (code length, symbol)
+    this->numberOfCodes.assign(this->maxCodeLength + 1, 0);
+    for (std::size_t symbol = 0; symbol < alphabetSize; symbol++) {
+        this->numberOfCodes[this->codeLengths[symbol]]++;
+    }
+    this->numberOfCodes[0] = 0;
+
+    this->firstSymbolIndex.assign(this->maxCodeLength + 1, 0);
+    for (unsigned int codeLength = 1; codeLength <= this->maxCodeLength; codeLength++) {
+        this->firstSymbolIndex[codeLength] = this->firstSymbolIndex[codeLength - 1] + this->numberOfCodes[codeLength - 1];
+    }
+    this->sortedSymbols.resize(numberOfSymbols);
+    std::vector<unsigned int> nextSymbolIndex = this->firstSymbolIndex;
+    for (std::size_t symbol = 0; symbol < alphabetSize; symbol++) {
+        if (this->codeLengths[symbol] > 0) {
+            this->sortedSymbols[nextSymbolIndex[this->codeLengths[symbol]]++] = static_cast<UnsignedSymbolType>(symbol);
+        }
+    }
+
+    // Assign the canonical codes; the first code of each length follows the last code of the previous length (shifted by one bit)
+    this->firstCode.assign(this->maxCodeLength + 1, 0);
+    for (unsigned int codeLength = 1; codeLength <= this->maxCodeLength; codeLength++) {
+        this->firstCode[codeLength] = (this->firstCode[codeLength - 1] + this->numberOfCodes[codeLength - 1]) << 1;
+        for (unsigned int rank = 0; rank < this->numberOfCodes[codeLength]; rank++) {
+            UnsignedSymbolType symbol = this->sortedSymbols[this->firstSymbolIndex[codeLength] + rank];
+            this->codes[symbol] = this->firstCode[codeLength] + rank;
+        }
+    }
+
+    // Fill the lookup table; every entry whose leading bits are a short code resolves to that code
+    this->lookupTable.assign(std::size_t(1) << this->lookupBits, LookupEntry{0, 0});
+    for (UnsignedSymbolType symbol : this->sortedSymbols) {
+        unsigned int codeLength = this->codeLengths[symbol];
+        if (codeLength > this->lookupBits) {
+            continue;
+        }
+        std::size_t firstEntry = std::size_t(this->codes[symbol]) << (this->lookupBits - codeLength);
+        std::size_t lastEntry = firstEntry + (std::size_t(1) << (this->lookupBits - codeLength));
+        for (std::size_t entry = firstEntry; entry < lastEntry; entry++) {
+            this->lookupTable[entry] = LookupEntry{symbol, static_cast<unsigned char>(codeLength)};
+        }
+    }
+}
+
+// Method to serialize the code lengths (the table a decoder needs); see the comment of the class for the format
+template <typename HuffmanSymbolType>
+std::vector<std::uint8_t> CanonicalHuffmanCodec<HuffmanSymbolType>::serializeCodeLengths() const {
+    std::vector<std::uint8_t> serializedCodeLengths;
+    std::size_t symbol = 0;
+    while (symbol < this->codeLengths.size()) {
+        if (this->codeLengths[symbol] > 0) {
+            serializedCodeLengths.push_back(this->codeLengths[symbol++]);
+            continue;
+        }
+        std::size_t runEnd = symbol;
+        while (runEnd < this->codeLengths.size() && this->codeLengths[runEnd] == 0) {
+            runEnd++;
+        }
+        if (runEnd == this->codeLengths.size()) {
+            break;                                  // The trailing run is implied
+        }
+        serializedCodeLengths.push_back(0);
+        for (std::size_t runLength = runEnd - symbol; ; runLength >>= 7) {
+            std::uint8_t runByte = static_cast<std::uint8_t>(runLength & 0x7F);
+            if (runLength >= 0x80) {
+                serializedCodeLengths.push_back(runByte | 0x80);
+            } else {
+                serializedCodeLengths.push_back(runByte);
+                break;
+            }
+        }
+        symbol = runEnd;
+    }
+    return serializedCodeLengths;
+}
+
+// Method to get the canonical code of a symbol as a string of bits (for displaying)
+template <typename HuffmanSymbolType>
+std::string CanonicalHuffmanCodec<HuffmanSymbolType>::getCodeString(HuffmanSymbolType symbol) const {
+    UnsignedSymbolType index = static_cast<UnsignedSymbolType>(symbol);
+    std::string codeString;
+    for (unsigned int bit = this->codeLengths[index]; bit-- > 0;) {
+        codeString += ((this->codes[index] >> bit) & 1) ? '1' : '0';
+    }
+    return codeString;
+}
+
+// Method to encode the symbols into packed bytes (the most significant bit first)
+template <typename HuffmanSymbolType>
+std::vector<std::uint8_t> CanonicalHuffmanCodec<HuffmanSymbolType>::encode(const std::vector<HuffmanSymbolType>& symbols, std::size_t& encodedBitLength) const {
+    std::vector<std::uint8_t> encodedBytes;
+    std::uint64_t bitBuffer = 0;
+    unsigned int bitsInBuffer = 0;
+    encodedBitLength = 0;
+
+    for (HuffmanSymbolType symbol : symbols) {
+        UnsignedSymbolType index = static_cast<UnsignedSymbolType>(symbol);
+        unsigned int codeLength = this->codeLengths[index];
+        if (codeLength == 0) {
+            throw std::invalid_argument("The symbol does not appear in the frequency table");
+        }
+
+        // Append the code, then flush the completed bytes (at most 7 bits remain in the buffer)
+        bitBuffer = (bitBuffer << codeLength) | this->codes[index];
+        bitsInBuffer += codeLength;
+        encodedBitLength += codeLength;
+        while (bitsInBuffer >= 8) {
+            bitsInBuffer -= 8;
+            encodedBytes.push_back(static_cast<std::uint8_t>(bitBuffer >> bitsInBuffer));
+        }
+    }
+    if (bitsInBuffer > 0) {
+        // Pad the last byte with zeros
+        encodedBytes.push_back(static_cast<std::uint8_t>(bitBuffer << (8 - bitsInBuffer)));
+    }
+    return encodedBytes;
+}
+
+// Method to decode the packed bytes back into the symbols
+template <typename HuffmanSymbolType>
+std::vector<HuffmanSymbolType> CanonicalHuffmanCodec<HuffmanSymbolType>::decode(const std::vector<std::uint8_t>& encodedBytes, std::size_t numberOfSymbols) const {
+    std::vector<HuffmanSymbolType> decodedSymbols;
+    decodedSymbols.reserve(numberOfSymbols);
+
+    std::uint64_t bitBuffer = 0;
+    unsigned int bitsInBuffer = 0;
+    std::size_t nextByteIndex = 0;
+
+    // Peek the next `length` bits without consuming them (zeros are fed past the end of the bytes)
+    auto peekBits = [&](unsigned int length) -> std::uint64_t {
+        while (bitsInBuffer < length) {
+            std::uint8_t nextByte = (nextByteIndex < encodedBytes.size()) ? encodedBytes[nextByteIndex] : 0;
+            nextByteIndex++;
+            bitBuffer = (bitBuffer << 8) | nextByte;
+            bitsInBuffer += 8;
+        }
+        return (bitBuffer >> (bitsInBuffer - length)) & ((std::uint64_t(1) << length) - 1);
+    };
+
+    while (decodedSymbols.size() < numberOfSymbols) {
+        // Fast path; a single table lookup resolves every code up to lookupBits bits
+        const LookupEntry& lookupEntry = this->lookupTable[peekBits(this->lookupBits)];
+        unsigned int codeLength = lookupEntry.codeLength;
+        UnsignedSymbolType symbol = lookupEntry.symbol;
+
+        if (codeLength == 0) {
+            // Slow path; extend the code one bit at a time until it falls into the range of the codes of that length
+            for (codeLength = this->lookupBits + 1; codeLength <= this->maxCodeLength; codeLength++) {
+                std::uint64_t offset = peekBits(codeLength) - this->firstCode[codeLength];
+                if (offset < this->numberOfCodes[codeLength]) {
+                    symbol = this->sortedSymbols[this->firstSymbolIndex[codeLength] + offset];
+                    break;
+                }
+            }
+            if (codeLength > this->maxCodeLength) {
+                throw std::runtime_error("Invalid Huffman code in the encoded bytes");
+            }
+        }
+
+        bitsInBuffer -= codeLength;
+        decodedSymbols.push_back(static_cast<HuffmanSymbolType>(symbol));
+    }
+    return decodedSymbols;
+}
+
+#endif // HUFFMAN_CODE_HPP
@@ -1,81 +1,15 @@
 /**
  * @file longest_processing_time_first.cpp
  * @brief A C++ implementation of the LPT(Largest Processing Time) scheduling algorithm for multiple machines
- *        LPT is a scheduling algorithm that schedules tasks based on their processing times
- *        The task with the longest processing time is scheduled first
- *        This implementation uses a priority queue to sort the tasks in descending order of processing times
- *        The tasks are then scheduled to the machine with the least current load.
- *        There is <queue> to implement the priority queue, so we can relatively easily implement the LPT algorithm. >_< 
+ *        The implementation itself lives in longest_processing_time_first.hpp, so that it can be benchmarked as well.
+ *        The tasks are scheduled to the machine with the least current load, in descending order of processing times.
  */
 
 #include <iostream>
-#include <queue>
 #include <vector>
-
-// Define the task structure with task ID and processing time
-struct Task {
-    unsigned int id;
-    unsigned int processingTime;
-
-    // Constructor
-    Task(unsigned int id, unsigned int processingTime) : id(id), processingTime(processingTime) {}
-
-    // Overload the less than operator for the priority queue
-    bool operator<(const Task& other) const {
-        return processingTime < other.processingTime;
-    }
-};
-
-// Define the machine structure with machine ID and current load
-struct Machine {
-    unsigned int id;
-    unsigned int currentLoad;
-
-    // Constructor
-    Machine(unsigned int id, unsigned int currentLoad = 0) : id(id), currentLoad(currentLoad) {}
-
-    // Overload the greater than operator for the priority queue (min heap)
-    bool operator>(const Machine& other) const {
-        return currentLoad > other.currentLoad;
-    }
-};
-
-// A function performing the LPT scheduling algorithm for multiple machines
-std::vector<std::vector<Task>> lptScheduling(std::vector<Task> tasks, unsigned int numMachines) {
-    // Create a priority queue to sort the tasks in descending order of processing times
-    std::priority_queue<Task> taskQueue;
-    for (const Task& task : tasks) {
-        taskQueue.push(task);
-    }
-
-    // Create a priority queue (min heap) for machines based on their current load
-    std::priority_queue<Machine, std::vector<Machine>, std::greater<Machine>> machineQueue;
-    for (unsigned int index = 0; index < numMachines; index++) {
-        machineQueue.push(Machine(index));
-    }
-
-    // Create a vector to store the tasks assigned to each machine
-    std::vector<std::vector<Task>> machineTasks(numMachines);
-
-    // Schedule the tasks to machines
-    while (!taskQueue.empty()) {
-        Task task = taskQueue.top();
-        taskQueue.pop();
-
-        // Get the machine with the least current load
-        Machine machine = machineQueue.top();
-        machineQueue.pop();
-
-        // Assign the task to this machine with the least current load
-        machineTasks[machine.id].push_back(task);
-        machine.currentLoad += task.processingTime;
-
-        // Push the machine back into the priority queue
-        machineQueue.push(machine);
-    }
-
-    return machineTasks;
-}
+#include <string>
+#include <utility>
+#include "longest_processing_time_first.hpp"
 
 int main() {
     // Create a vector of tasks with task ID and processing time
@@ -110,6 +44,62 @@ int main() {
         std::cout << "Machine " << index + 1 << " Total Load: " << totalTime << std::endl;
     }
 
+    // Perform the LPT scheduling algorithm at scale (compact machine ID per task)
+    std::vector<unsigned int> machineIds = lptSchedulingCompact(tasks, numMachines);
+    std::vector<unsigned int> machineLoads(numMachines, 0);
+    std::cout << "Compact assignments (task -> machine): ";
+    for (std::size_t index = 0; index < tasks.size(); index++) {
+        std::cout << tasks[index].id << "->" << machineIds[index] + 1 << " ";
+        machineLoads[machineIds[index]] += tasks[index].processingTime;
+    }
+    std::cout << std::endl;
+    for (unsigned int index = 0; index < numMachines; index++) {
+        std::cout << "Machine " << index + 1 << " Total Load (compact): " << machineLoads[index] << std::endl;
+    }
+
+    // Online scheduling over heterogeneous machines (machine 1 is twice as fast as the others)
+    OnlineLptScheduler onlineScheduler(std::vector<double>{2.0, 1.0, 1.0});
+    std::vector<Task> firstBatch(tasks.begin(), tasks.begin() + 5);
+    std::vector<unsigned int> firstBatchMachineIds = onlineScheduler.submitBatch(firstBatch);
+    std::cout << "Online batch dispatched to machines: ";
+    for (std::size_t index = 0; index < firstBatch.size(); index++) {
+        std::cout << firstBatch[index].id << "->" << firstBatchMachineIds[index] + 1 << " ";
+    }
+    std::cout << std::endl;
+
+    // Task 3 (the longest one, on machine 1) completes, then the remaining tasks arrive one by one
+    onlineScheduler.complete(0, 3);
+    std::cout << "Online tasks dispatched to machines: ";
+    for (auto task = tasks.begin() + 5; task != tasks.end(); task++) {
+        std::cout << task->id << "->" << onlineScheduler.submit(*task) + 1 << " ";
+    }
+    std::cout << std::endl;
+    std::cout << onlineScheduler.exportMetrics();
+
+    // A fast machine (speed 4) busy with a short task and an idle slow machine (speed 1) compete for a long task;
+    // the long task finishes at (8 + 20) / 4 = 7 on the fast machine, but only at 20 / 1 = 20 on the idle slow one
+    OnlineLptScheduler speedAwareScheduler(std::vector<double>{4.0, 1.0});
+    speedAwareScheduler.submit(Task(101, 8));
+    std::cout << "Long task dispatched to machine " << speedAwareScheduler.submit(Task(102, 20)) + 1
+              << " (makespan " << speedAwareScheduler.getMakespan() << ")" << std::endl;
+
+    // Multifit and Karmarkar-Karp schedulers (the same input and output types as lptScheduling)
+    std::vector<std::pair<std::string, std::vector<std::vector<Task>>>> alternativeSchedules = {
+        {"Multifit", multifitScheduling(tasks, numMachines)},
+        {"Karmarkar-Karp", karmarkarKarpScheduling(tasks, numMachines)},
+    };
+    for (const auto& alternativeSchedule : alternativeSchedules) {
+        std::cout << alternativeSchedule.first << " machine loads: ";
+        for (const std::vector<Task>& machineTasks : alternativeSchedule.second) {
+            unsigned int totalTime = 0;
+            for (const Task& task : machineTasks) {
+                totalTime += task.processingTime;
+            }
+            std::cout << totalTime << " ";
+        }
+        std::cout << std::endl;
+    }
+
     return 0;
 }
 
@@ -128,4 +118,22 @@ int main() {
 //   Task 9 (Processing Time: 9) Total Time: 19
 //   Task 8 (Processing Time: 6) Total Time: 25
 //   Task 5 (Processing Time: 3) Total Time: 28
-// Machine 3 Total Load: 28
\ No newline at end of file
+// Machine 3 Total Load: 28
+// Compact assignments (task -> machine): 1->3 2->2 3->1 4->1 5->2 6->2 7->2 8->3 9->3 10->1
+// Machine 1 Total Load (compact): 26
+// Machine 2 Total Load (compact): 28
+// Machine 3 Total Load (compact): 25
+// (Machine 2 and 3 are tied at 25 before the last task, and the compact version breaks ties by the lower machine ID)
+// Online batch dispatched to machines: 1->2 2->1 3->1 4->3 5->3
+// Online tasks dispatched to machines: 6->1 7->1 8->1 9->2 10->3
+// lpt_scheduler_makespan 19
+// lpt_scheduler_imbalance 1.17526
+// lpt_scheduler_running_tasks 9
+// lpt_scheduler_submitted_tasks_total 10
+// lpt_scheduler_completed_tasks_total 1
+// lpt_scheduler_machine_load{machine="0"} 31
+// lpt_scheduler_machine_load{machine="1"} 19
+// lpt_scheduler_machine_load{machine="2"} 14
+// Long task dispatched to machine 1 (makespan 7)
+// Multifit machine loads: 27 27 25
+// Karmarkar-Karp machine loads: 27 26 26
\ No newline at end of file
@@ -0,0 +1,567 @@
+/**
+ * @file longest_processing_time_first.hpp
+ * @brief A C++ implementation of the LPT(Largest Processing Time) scheduling algorithm for multiple machines
+ *        LPT is a scheduling algorithm that schedules tasks based on their processing times
+ *        The task with the longest processing time is scheduled first
+ *        This implementation uses a priority queue to sort the tasks in descending order of processing times
+ *        The tasks are then scheduled to the machine with the least current load.
+ *        There is <queue> to implement the priority queue, so we can relatively easily implement the LPT algorithm. >_<
+ *        Multifit and Karmarkar-Karp schedulers (tighter makespan than LPT) are provided alongside with the same input and output types.
+ *        It is shared by longest_processing_time_first.cpp (example) and longest_processing_time_first_benchmark.cpp (benchmark).
+ */
+
+#ifndef LONGEST_PROCESSING_TIME_FIRST_HPP
+#define LONGEST_PROCESSING_TIME_FIRST_HPP
+
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+
+// Define the task structure with task ID and processing time
+struct Task {
+    unsigned int id;
+    unsigned int processingTime;
+
+    // Constructor
+    Task(unsigned int id, unsigned int processingTime) : id(id), processingTime(processingTime) {}
+
+    // Overload the less than operator for the priority queue
+    bool operator<(const Task& other) const {
+        return processingTime < other.processingTime;
+    }
+};
+
+// Define the machine structure with machine ID and current load
+struct Machine {
+    unsigned int id;
+    unsigned int currentLoad;
+
+    // Constructor
+    Machine(unsigned int id, unsigned int currentLoad = 0) : id(id), currentLoad(currentLoad) {}
+
+    // Overload the greater than operator for the priority queue (min heap)
+    bool operator>(const Machine& other) const {
+        return currentLoad > other.currentLoad;
+    }
+};
+
+// A function performing the LPT scheduling algorithm for multiple machines
+inline std::vector<std::vector<Task>> lptScheduling(std::vector<Task> tasks, unsigned int numMachines) {
+    // Create a priority queue to sort the tasks in descending order of processing times
+    std::priority_queue<Task> taskQueue;
+    for (const Task& task : tasks) {
+        taskQueue.push(task);
+    }
+
+    // Create a priority queue (min heap) for machines based on their current load
+    std::priority_queue<Machine, std::vector<Machine>, std::greater<Machine>> machineQueue;
+    for (unsigned int index = 0; index < numMachines; index++) {
+        machineQueue.push(Machine(index));
+    }
+
+    // Create a vector to store the tasks assigned to each machine
+    std::vector<std::vector<Task>> machineTasks(numMachines);
+
+    // Schedule the tasks to machines
+    while (!taskQueue.empty()) {
+        Task task = taskQueue.top();
+        taskQueue.pop();
+
+        // Get the machine with the least current load
+        Machine machine = machineQueue.top();
+        machineQueue.pop();
+
+        // Assign the task to this machine with the least current load
+        machineTasks[machine.id].push_back(task);
+        machine.currentLoad += task.processingTime;
+
+        // Push the machine back into the priority queue
+        machineQueue.push(machine);
+    }
+
+    return machineTasks;
+}
+
+// A helper function to sort the task indices in descending order of processing times via LSD radix sort
+// Only the indices (4 bytes each) are moved, never the tasks themselves, and each pass is O(n) over 8 bits of the key.
+// A pass is skipped when every key has the same digit (e.g. the upper bytes of small processing times), so short keys cost fewer passes.
+// The sort is stable, so the tasks with the same processing time keep their original order.
+inline std::vector<std::uint32_t> radixSortTaskIndicesDescending(const std::vector<Task>& tasks) {
+    const std::size_t numTasks = tasks.size();
+    std::vector<std::uint32_t> taskIndices(numTasks), sortedTaskIndices(numTasks);
+    for (std::size_t index = 0; index < numTasks; index++) {
+        taskIndices[index] = static_cast<std::uint32_t>(index);
+    }
+
+    for (unsigned int shift = 0; shift < 32; shift += 8) {
+        // Count the digits; the key is inverted (~processingTime) so that ascending order of keys is descending order of times
+        std::size_t digitCounts[256] = {0};
+        for (std::uint32_t taskIndex : taskIndices) {
+            digitCounts[(~tasks[taskIndex].processingTime >> shift) & 0xFF]++;
+        }
+        if (numTasks == 0 || digitCounts[(~tasks[taskIndices[0]].processingTime >> shift) & 0xFF] == numTasks) {
+            continue;
+        }
+
+        // Turn the counts into the starting positions, then scatter the indices
+        std::size_t position = 0;
+        for (std::size_t& digitCount : digitCounts) {
+            std::size_t count = digitCount;
+            digitCount = position;
+            position += count;
+        }
+        for (std::uint32_t taskIndex : taskIndices) {
+            sortedTaskIndices[digitCounts[(~tasks[taskIndex].processingTime >> shift) & 0xFF]++] = taskIndex;
+        }
+        taskIndices.swap(sortedTaskIndices);
+    }
+    return taskIndices;
+}
+
+// A function performing the LPT scheduling algorithm at scale, in O(n + n log m) time for n tasks and m machines
+// Unlike lptScheduling, nothing is copied per task:
+//  - the tasks are taken by reference, and only their indices are (radix) sorted once
+//  - the machines live in a flat min heap of (load, machine ID) entries, and the least loaded machine at the root
+//    is updated in place and sifted down, instead of popping and pushing a Machine object per task
+//  - the result is a compact array where machineIds[i] is the (0-based) machine that the i-th task is assigned to
+inline std::vector<unsigned int> lptSchedulingCompact(const std::vector<Task>& tasks, unsigned int numMachines) {
+    std::vector<unsigned int> machineIds(tasks.size(), 0);
+    if (numMachines == 0 || tasks.empty()) {
+        return machineIds;
+    }
+
+    // Flat min heap of machines; all loads are 0 at first, so the array in the ID order is already a valid heap
+    struct MachineHeapEntry {
+        unsigned long long load;
+        unsigned int id;
+
+        bool operator<(const MachineHeapEntry& other) const {
+            return load < other.load || (load == other.load && id < other.id);
+        }
+    };
+    std::vector<MachineHeapEntry> machineHeap(numMachines);
+    for (unsigned int index = 0; index < numMachines; index++) {
+        machineHeap[index] = MachineHeapEntry{0, index};
+    }
+
+    for (std::uint32_t taskIndex : radixSortTaskIndicesDescending(tasks)) {
+        // Assign the task to the least loaded machine (the root), and add the processing time to its load in place
+        MachineHeapEntry root = machineHeap[0];
+        machineIds[taskIndex] = root.id;
+        root.load += tasks[taskIndex].processingTime;
+
+        // Sift the updated root down; the load only grows, so it never has to move up
+        std::size_t index = 0;
+        while (true) {
+            std::size_t smallestChildIndex = 2 * index + 1;
+            if (smallestChildIndex >= numMachines) {
+                break;
+            }
+            if (smallestChildIndex + 1 < numMachines && machineHeap[smallestChildIndex + 1] < machineHeap[smallestChildIndex]) {
+                smallestChildIndex++;
+            }
+            if (!(machineHeap[smallestChildIndex] < root)) {
+                break;
+            }
+            machineHeap[index] = machineHeap[smallestChildIndex];
+            index = smallestChildIndex;
+        }
+        machineHeap[index] = root;
+    }
+
+    return machineIds;
+}
+
+// An online (streaming) LPT / list scheduler for tasks arriving continuously
+// Each machine has a speed (1.0 by default), so its expected finish time is (current load / speed).
+// A task of processing time p is dispatched to the machine that would finish it the earliest, i.e. with the smallest (load + p) / speed;
+// a slow idle machine may lose a long task to a fast, slightly busier one. Within the machines of the same speed, that is the least loaded one,
+// so the machines are grouped into k speed classes, each with an indexed min heap by the load, and submit() compares the k roots.
+// The heap position of every machine is tracked, so when a task completes and the machine's load drops, only that machine is sifted up in place.
+// Therefore, submit() costs O(k + log m) and complete() O(log m) for m machines (k = 1 for identical machines).
+//  - submit()      : list scheduling; the task goes to the machine finishing it the earliest right away
+//  - submitBatch() : online LPT; the tasks arrived at the same time are submitted in descending order of processing times
+//  - complete()    : the task has finished, so its processing time is removed from the machine's load
+class OnlineLptScheduler {
+private:
+    std::vector<Machine> machines;                  // Machines with their current (outstanding) loads, indexed by machine ID
+    std::vector<double> machineSpeeds;              // Speed of each machine (processing time units per time unit)
+    std::vector<double> classSpeeds;                // Speed of each speed class
+    std::vector<std::vector<unsigned int>> classHeaps;  // Min heap of machine IDs by the load, per speed class
+    std::vector<unsigned int> machineClasses;       // Speed class of each machine
+    std::vector<unsigned int> heapPositions;        // Position of each machine in the heap of its class
+    std::unordered_map<unsigned int, std::pair<unsigned int, unsigned int>> runningTasks;   // task ID -> (machine ID, processing time)
+    unsigned long long numSubmittedTasks = 0;
+    unsigned long long numCompletedTasks = 0;
+
+    double getFinishTime(unsigned int machineId) const { return this->machines[machineId].currentLoad / this->machineSpeeds[machineId]; }
+    bool isLessLoaded(unsigned int machineId1, unsigned int machineId2) const;
+    void swapHeapEntries(std::vector<unsigned int>& heap, std::size_t index1, std::size_t index2);
+    void heapifyUp(std::vector<unsigned int>& heap, std::size_t index);     // Helper method to restore the heap property after a load decrease
+    void heapifyDown(std::vector<unsigned int>& heap, std::size_t index);   // Helper method to restore the heap property after a load increase
+
+public:
+    OnlineLptScheduler(unsigned int numMachines);
+    OnlineLptScheduler(const std::vector<double>& machineSpeeds);
+
+    unsigned int submit(const Task& task);                          // Method to dispatch a task, returning the assigned machine ID
+    std::vector<unsigned int> submitBatch(const std::vector<Task>& tasks); // Method to dispatch tasks arrived together in the LPT order
+    void complete(unsigned int machineId, unsigned int taskId);     // Method to mark a running task as completed
+    const Machine& getMachine(unsigned int machineId) const { return this->machines.at(machineId); }
+    double getMakespan() const;                                     // The latest expected finish time among the machines
+    double getImbalance() const;                                    // Makespan divided by the average finish time (1.0 is perfectly balanced)
+    std::string exportMetrics() const;                              // Metrics in the Prometheus text format for scraping
+};
+
+// Constructor for identical machines (all speeds are 1.0)
+inline OnlineLptScheduler::OnlineLptScheduler(unsigned int numMachines) : OnlineLptScheduler(std::vector<double>(numMachines, 1.0)) {}
+
+// Constructor for heterogeneous machines
+inline OnlineLptScheduler::OnlineLptScheduler(const std::vector<double>& machineSpeeds) : machineSpeeds(machineSpeeds) {
+    if (machineSpeeds.empty()) {
+        throw std::invalid_argument("At least one machine is required");
+    }
+    for (unsigned int index = 0; index < machineSpeeds.size(); index++) {
+        if (!(machineSpeeds[index] > 0)) {
+            throw std::invalid_argument("Machine speeds must be positive");
+        }
+        // All loads are 0 at first, so the machines of a class in the ID order already form a valid heap
+        unsigned int classIndex = static_cast<unsigned int>(std::find(this->classSpeeds.begin(), this->classSpeeds.end(), machineSpeeds[index])
+                                                            - this->classSpeeds.begin());
+        if (classIndex == this->classSpeeds.size()) {
+            this->classSpeeds.push_back(machineSpeeds[index]);
+            this->classHeaps.emplace_back();
+        }
+        this->machines.push_back(Machine(index));
+        this->machineClasses.push_back(classIndex);
+        this->heapPositions.push_back(static_cast<unsigned int>(this->classHeaps[classIndex].size()));
+        this->classHeaps[classIndex].push_back(index);
+    }
+}
+
+// Compare two machines of the same speed class by the load (the lower ID first on a tie)
+inline bool OnlineLptScheduler::isLessLoaded(unsigned int machineId1, unsigned int machineId2) const {
+    unsigned int load1 = this->machines[machineId1].currentLoad;
+    unsigned int load2 = this->machines[machineId2].currentLoad;
+    return load1 < load2 || (load1 == load2 && machineId1 < machineId2);
+}
+
+// Swap two heap entries, keeping the heap positions up to date
+inline void OnlineLptScheduler::swapHeapEntries(std::vector<unsigned int>& heap, std::size_t index1, std::size_t index2) {
+    std::swap(heap[index1], heap[index2]);
+    this->heapPositions[heap[index1]] = static_cast<unsigned int>(index1);
+    this->heapPositions[heap[index2]] = static_cast<unsigned int>(index2);
+}
+
+// Helper method to restore the heap property after a load decrease
+inline void OnlineLptScheduler::heapifyUp(std::vector<unsigned int>& heap, std::size_t index) {
+    while (index > 0) {
+        std::size_t parentIndex = (index - 1) / 2;
+        if (!isLessLoaded(heap[index], heap[parentIndex])) {
+            break;
+        }
+        swapHeapEntries(heap, index, parentIndex);
+        index = parentIndex;
+    }
+}
+
+// Helper method to restore the heap property after a load increase
+inline void OnlineLptScheduler::heapifyDown(std::vector<unsigned int>& heap, std::size_t index) {
+    const std::size_t heapSize = heap.size();
+    while (true) {
+        std::size_t leastLoadedIndex = index;
+        std::size_t leftChildIndex = 2 * index + 1;
+        std::size_t rightChildIndex = 2 * index + 2;
+        if (leftChildIndex < heapSize && isLessLoaded(heap[leftChildIndex], heap[leastLoadedIndex])) {
+            leastLoadedIndex = leftChildIndex;
+        }
+        if (rightChildIndex < heapSize && isLessLoaded(heap[rightChildIndex], heap[leastLoadedIndex])) {
+            leastLoadedIndex = rightChildIndex;
+        }
+        if (leastLoadedIndex == index) {
+            break;
+        }
+        swapHeapEntries(heap, index, leastLoadedIndex);
+        index = leastLoadedIndex;
+    }
+}
+
+// Method to dispatch a task to the machine finishing it the earliest, returning the assigned machine ID
+inline unsigned int OnlineLptScheduler::submit(const Task& task) {
+    if (this->runningTasks.count(task.id) > 0) {
+        throw std::invalid_argument("The task is already running");
+    }
+
+    // The root of each class is its least loaded machine; the one finishing the task the earliest wins (the lower ID first on a tie)
+    unsigned int machineId = this->classHeaps[0][0];
+    double bestFinishTime = (this->machines[machineId].currentLoad + static_cast<double>(task.processingTime)) / this->classSpeeds[0];
+    for (unsigned int classIndex = 1; classIndex < this->classHeaps.size(); classIndex++) {
+        unsigned int candidateId = this->classHeaps[classIndex][0];
+        double finishTime = (this->machines[candidateId].currentLoad + static_cast<double>(task.processingTime)) / this->classSpeeds[classIndex];
+        if (finishTime < bestFinishTime || (finishTime == bestFinishTime && candidateId < machineId)) {
+            machineId = candidateId;
+            bestFinishTime = finishTime;
+        }
+    }
+
+    // The chosen machine is the root of its class; its load grows, so it is sifted down in place
+    this->machines[machineId].currentLoad += task.processingTime;
+    heapifyDown(this->classHeaps[this->machineClasses[machineId]], 0);
+
+    this->runningTasks[task.id] = {machineId, task.processingTime};
+    this->numSubmittedTasks++;
+    return machineId;
+}
+
+// Method to dispatch tasks arrived together in the LPT order (the longest processing time first)
+// The returned machine IDs are in the same order as the given tasks
+inline std::vector<unsigned int> OnlineLptScheduler::submitBatch(const std::vector<Task>& tasks) {
+    std::vector<std::size_t> taskIndices(tasks.size());
+    for (std::size_t index = 0; index < tasks.size(); index++) {
+        taskIndices[index] = index;
+    }
+    std::stable_sort(taskIndices.begin(), taskIndices.end(), [&tasks](std::size_t a, std::size_t b) {
+        return tasks[b] < tasks[a];
+    });
+
+    std::vector<unsigned int> machineIds(tasks.size());
+    for (std::size_t taskIndex : taskIndices) {
+        machineIds[taskIndex] = submit(tasks[taskIndex]);
+    }
+    return machineIds;
+}
+
+// Method to mark a running task as completed; its processing time is removed from the machine's load
+inline void OnlineLptScheduler::complete(unsigned int machineId, unsigned int taskId) {
+    auto runningTask = this->runningTasks.find(taskId);
+    if (runningTask == this->runningTasks.end() || runningTask->second.first != machineId) {
+        throw std::invalid_argument("The task is not running on the given machine");
+    }
+
+    // The load only drops, so the machine is sifted up from its current position in the heap
+    this->machines[machineId].currentLoad -= runningTask->second.second;
+    heapifyUp(this->classHeaps[this->machineClasses[machineId]], this->heapPositions[machineId]);
+
+    this->runningTasks.erase(runningTask);
+    this->numCompletedTasks++;
+}
+
+// The latest expected finish time among the machines
+inline double OnlineLptScheduler::getMakespan() const {
+    double makespan = 0;
+    for (unsigned int machineId = 0; machineId < this->machines.size(); machineId++) {
+        makespan = std::max(makespan, getFinishTime(machineId));
+    }
+    return makespan;
+}
+
+// Makespan divided by the average finish time (1.0 is perfectly balanced, 1.0 is also reported when all machines are idle)
+inline double OnlineLptScheduler::getImbalance() const {
+    double totalFinishTime = 0;
+    for (unsigned int machineId = 0; machineId < this->machines.size(); machineId++) {
+        totalFinishTime += getFinishTime(machineId);
+    }
+    if (totalFinishTime == 0) {
+        return 1.0;
+    }
+    return getMakespan() / (totalFinishTime / this->machines.size());
+}
+
+// Metrics in the Prometheus text format for scraping
+inline std::string OnlineLptScheduler::exportMetrics() const {
+    std::ostringstream metrics;
+    metrics << "lpt_scheduler_makespan " << getMakespan() << "\n";
+    metrics << "lpt_scheduler_imbalance " << getImbalance() << "\n";
+    metrics << "lpt_scheduler_running_tasks " << this->runningTasks.size() << "\n";
+    metrics << "lpt_scheduler_submitted_tasks_total " << this->numSubmittedTasks << "\n";
+    metrics << "lpt_scheduler_completed_tasks_total " << this->numCompletedTasks << "\n";
+    for (const Machine& machine : this->machines) {
+        metrics << "lpt_scheduler_machine_load{machine=\"" << machine.id << "\"} " << machine.currentLoad << "\n";
+    }
+    return metrics.str();
+}
+
+// A helper function performing FFD(First Fit Decreasing) bin packing of the tasks into numMachines bins of the given capacity
+// The tasks must be given in descending order of processing times (as task indices).
+// A segment tree keeps the maximum remaining capacity of each range of bins, so "the first bin that fits" is found in O(log m).
+// Returns false if some task does not fit into any bin; otherwise, machineIds[i] holds the bin of the i-th task.
+inline bool firstFitDecreasingPacking(const std::vector<Task>& tasks, const std::vector<std::uint32_t>& sortedTaskIndices,
+                                      unsigned int numMachines, unsigned long long capacity, std::vector<unsigned int>& machineIds) {
+    std::size_t numLeaves = 1;
+    while (numLeaves < numMachines) {
+        numLeaves *= 2;
+    }
+
+    // Leaves are the remaining capacities of the bins (the padding leaves have no capacity)
+    std::vector<unsigned long long> maxRemainingCapacity(2 * numLeaves, 0);
+    for (unsigned int machineId = 0; machineId < numMachines; machineId++) {
+        maxRemainingCapacity[numLeaves + machineId] = capacity;
+    }
+    for (std::size_t node = numLeaves - 1; node > 0; node--) {
+        maxRemainingCapacity[node] = std::max(maxRemainingCapacity[2 * node], maxRemainingCapacity[2 * node + 1]);
+    }
+
+    for (std::uint32_t taskIndex : sortedTaskIndices) {
+        unsigned long long processingTime = tasks[taskIndex].processingTime;
+        if (maxRemainingCapacity[1] < processingTime) {
+            return false;
+        }
+
+        // Descend to the leftmost bin that fits, then update the path back to the root
+        std::size_t node = 1;
+        while (node < numLeaves) {
+            node = (maxRemainingCapacity[2 * node] >= processingTime) ? 2 * node : 2 * node + 1;
+        }
+        machineIds[taskIndex] = static_cast<unsigned int>(node - numLeaves);
+        maxRemainingCapacity[node] -= processingTime;
+        for (node /= 2; node > 0; node /= 2) {
+            maxRemainingCapacity[node] = std::max(maxRemainingCapacity[2 * node], maxRemainingCapacity[2 * node + 1]);
+        }
+    }
+    return true;
+}
+
+// A helper function to group the tasks by the assigned machines (the output type of lptScheduling)
+inline std::vector<std::vector<Task>> groupTasksByMachine(const std::vector<Task>& tasks, const std::vector<std::uint32_t>& taskOrder,
+                                                          const std::vector<unsigned int>& machineIds, unsigned int numMachines) {
+    std::vector<std::vector<Task>> machineTasks(numMachines);
+    for (std::uint32_t taskIndex : taskOrder) {
+        machineTasks[machineIds[taskIndex]].push_back(tasks[taskIndex]);
+    }
+    return machineTasks;
+}
+
+// A function performing the Multifit scheduling algorithm for multiple machines
+// Multifit binary searches the smallest capacity C such that FFD packs all tasks into numMachines bins of capacity C.
+//  - lower bound: max(ceil(total / m), longest processing time); no schedule can be shorter than that
+//  - upper bound: max(ceil(2 * total / m), longest processing time); FFD is known to always succeed with it
+// Since the processing times are integers, the search runs until the bounds meet (about log2(total / m) FFD runs),
+// which gives a 13/11-approximation (tighter than 4/3 of LPT) at the cost of O(n log m) per FFD run.
+// FFD feasibility is not monotone in the capacity (FFD may fail at C and succeed just below it), so the search is a heuristic
+// over it; it may miss a smaller feasible capacity, and the schedule of the best (smallest) feasible capacity tried is returned.
+inline std::vector<std::vector<Task>> multifitScheduling(const std::vector<Task>& tasks, unsigned int numMachines) {
+    if (numMachines == 0) {
+        throw std::invalid_argument("At least one machine is required");
+    }
+    std::vector<std::uint32_t> sortedTaskIndices = radixSortTaskIndicesDescending(tasks);
+
+    unsigned long long totalProcessingTime = 0, longestProcessingTime = 0;
+    for (const Task& task : tasks) {
+        totalProcessingTime += task.processingTime;
+        longestProcessingTime = std::max<unsigned long long>(longestProcessingTime, task.processingTime);
+    }
+    unsigned long long lowerCapacity = std::max((totalProcessingTime + numMachines - 1) / numMachines, longestProcessingTime);
+    unsigned long long upperCapacity = std::max((2 * totalProcessingTime + numMachines - 1) / numMachines, longestProcessingTime);
+
+    std::vector<unsigned int> machineIds(tasks.size(), 0), bestMachineIds(tasks.size(), 0);
+    if (!firstFitDecreasingPacking(tasks, sortedTaskIndices, numMachines, upperCapacity, bestMachineIds)) {
+        // Not expected by the theory, but fall back to LPT rather than returning an invalid schedule
+        return groupTasksByMachine(tasks, sortedTaskIndices, lptSchedulingCompact(tasks, numMachines), numMachines);
+    }
+
+    // Invariant: upperCapacity is the best capacity found so far (FFD succeeded with it); lowerCapacity only bounds the search
+    while (lowerCapacity < upperCapacity) {
+        unsigned long long capacity = lowerCapacity + (upperCapacity - lowerCapacity) / 2;
+        if (firstFitDecreasingPacking(tasks, sortedTaskIndices, numMachines, capacity, machineIds)) {
+            upperCapacity = capacity;
+            bestMachineIds.swap(machineIds);
+        } else {
+            lowerCapacity = capacity + 1;
+        }
+    }
+
+    return groupTasksByMachine(tasks, sortedTaskIndices, bestMachineIds, numMachines);
+}
+
+// A function performing the Karmarkar-Karp (largest differencing method) scheduling algorithm for multiple machines
+// Every task starts as a partial solution of m subsets: {its own processing time, 0, 0, ..., 0}.
+// The two partial solutions with the largest differences (max sum - min sum) are repeatedly merged into one,
+// pairing the largest subset of one with the smallest subset of the other, so that the difference is cancelled out as much as possible.
+// The last remaining partial solution is the schedule. Only the non-empty subsets of a partial solution are stored (the rest are implicit
+// zeros), and a task is not stored as a partial solution until it is merged. Every task is in one stored subset, so the live partial solutions
+// take O(n) memory in total, and a merge costs O(k log k) for its k <= m non-empty subsets, O(n log n + n min(n, m) log m) time at most.
+// It usually beats LPT when there are many tasks per machine.
+inline std::vector<std::vector<Task>> karmarkarKarpScheduling(const std::vector<Task>& tasks, unsigned int numMachines) {
+    if (numMachines == 0) {
+        throw std::invalid_argument("At least one machine is required");
+    }
+    if (tasks.empty()) {
+        return std::vector<std::vector<Task>>(numMachines);
+    }
+
+    // A subset of a partial solution; its tasks form a singly linked list over task indices, so merging two subsets is O(1)
+    struct TaskSubset {
+        unsigned long long sum;
+        std::uint32_t head;
+        std::uint32_t tail;
+    };
+    const std::uint32_t NO_TASK = UINT32_MAX;
+    std::vector<std::uint32_t> nextTaskIndices(tasks.size(), NO_TASK);
+
+    // Partial solutions, each of them is up to numMachines non-empty subsets sorted in descending order of sums
+    // An empty partial solution stands for the single task of its index, which is not stored until it is merged.
+    std::vector<std::vector<TaskSubset>> partialSolutions(tasks.size());
+    std::priority_queue<std::pair<unsigned long long, std::uint32_t>> differenceQueue;   // (difference, partial solution index)
+    for (std::uint32_t taskIndex = 0; taskIndex < tasks.size(); taskIndex++) {
+        differenceQueue.push({numMachines > 1 ? tasks[taskIndex].processingTime : 0, taskIndex});
+    }
+    auto getPartialSolution = [&](std::uint32_t index) -> std::vector<TaskSubset>& {
+        if (partialSolutions[index].empty()) {
+            partialSolutions[index].push_back(TaskSubset{tasks[index].processingTime, index, index});
+        }
+        return partialSolutions[index];
+    };
+
+    std::vector<TaskSubset> merged;
+    while (differenceQueue.size() > 1) {
+        std::uint32_t largerIndex = differenceQueue.top().second; differenceQueue.pop();
+        std::uint32_t smallerIndex = differenceQueue.top().second; differenceQueue.pop();
+        std::vector<TaskSubset>& larger = getPartialSolution(largerIndex);
+        std::vector<TaskSubset>& other = getPartialSolution(smallerIndex);
+
+        // Pair the i-th largest subset of one with the i-th smallest subset of the other; in the padded form, larger[i] is non-empty
+        // for i < largerSize and other[numMachines - 1 - i] for i >= numMachines - otherSize, so only those positions are visited
+        const std::size_t largerSize = larger.size(), otherSize = other.size();
+        const std::size_t firstPairedIndex = std::max<std::size_t>(largerSize, numMachines - otherSize);
+        merged.clear();
+        for (std::size_t index = 0; index < numMachines; index = (index + 1 == largerSize) ? firstPairedIndex : index + 1) {
+            TaskSubset subset = (index < largerSize) ? larger[index] : TaskSubset{0, NO_TASK, NO_TASK};
+            if (index >= numMachines - otherSize) {
+                const TaskSubset& pairedSubset = other[numMachines - 1 - index];
+                if (subset.head == NO_TASK) {
+                    subset.head = pairedSubset.head;
+                } else {
+                    nextTaskIndices[subset.tail] = pairedSubset.head;
+                }
+                subset.tail = pairedSubset.tail;
+                subset.sum += pairedSubset.sum;
+            }
+            merged.push_back(subset);
+        }
+        std::vector<TaskSubset>().swap(other);     // Release the memory of the merged partial solution
+
+        std::sort(merged.begin(), merged.end(), [](const TaskSubset& a, const TaskSubset& b) {
+            return a.sum > b.sum;
+        });
+        larger.swap(merged);
+        const unsigned long long smallestSum = (larger.size() < numMachines) ? 0 : larger.back().sum;
+        differenceQueue.push({larger.front().sum - smallestSum, largerIndex});
+    }
+
+    // Walk the linked lists of the last partial solution
+    const std::vector<TaskSubset>& solution = getPartialSolution(differenceQueue.top().second);
+    std::vector<std::vector<Task>> machineTasks(numMachines);
+    for (unsigned int machineId = 0; machineId < solution.size(); machineId++) {
+        for (std::uint32_t taskIndex = solution[machineId].head; taskIndex != NO_TASK; taskIndex = nextTaskIndices[taskIndex]) {
+            machineTasks[machineId].push_back(tasks[taskIndex]);
+        }
+    }
+    return machineTasks;
+}
+
+#endif // LONGEST_PROCESSING_TIME_FIRST_HPP
@@ -0,0 +1,260 @@
+/**
+ * @file longest_processing_time_first_benchmark.cpp
+ * @brief A benchmark comparing the makespan quality against the runtime of the schedulers in longest_processing_time_first.hpp
+ *        (lptScheduling, lptSchedulingCompact, multifitScheduling, karmarkarKarpScheduling)
+ *        on synthetic workloads, and optionally on a replayed workload read from a file.
+ *        The quality is reported as the ratio of the makespan to the lower bound max(ceil(total / m), longest processing time),
+ *        so 1.0 means the schedule is provably optimal.
+ *
+ *        Build & Run: g++ -std=c++11 -O2 longest_processing_time_first_benchmark.cpp -o longest_processing_time_first_benchmark
+ *                     ./longest_processing_time_first_benchmark [--replay <file>] [--machines M] [--format csv|json]
+ *        The replayed file holds one task per line, either "processingTime" or "id,processingTime" (the IDs must be unique).
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include "longest_processing_time_first.hpp"
+
+// A workload to be scheduled, either synthetic or replayed
+struct Workload {
+    std::string name;
+    std::vector<Task> tasks;
+    unsigned int numMachines;
+};
+
+// The measured result of a single scheduler over a single workload
+struct BenchmarkResult {
+    std::string workloadName;
+    std::string schedulerName;
+    std::size_t numTasks;
+    unsigned int numMachines;
+    unsigned long long makespan;
+    unsigned long long lowerBound;
+    double runtimeMilliseconds;
+    bool valid;     // Every task is scheduled exactly once
+};
+
+// Generate a synthetic workload; the seed is fixed so that the workloads are the same across runs (and commits)
+Workload generateSyntheticWorkload(const std::string& distribution, std::size_t numTasks, unsigned int numMachines) {
+    std::mt19937_64 randomEngine(20240501);
+    std::uniform_int_distribution<unsigned int> uniformDistribution(1, 1000);
+    std::exponential_distribution<double> exponentialDistribution(1.0 / 100.0);
+    std::uniform_int_distribution<unsigned int> smallDistribution(1, 10), largeDistribution(500, 1000);
+    std::bernoulli_distribution isLargeTask(0.1);
+
+    Workload workload;
+    workload.name = distribution + "-n" + std::to_string(numTasks) + "-m" + std::to_string(numMachines);
+    workload.numMachines = numMachines;
+    workload.tasks.reserve(numTasks);
+    for (std::size_t index = 0; index < numTasks; index++) {
+        unsigned int processingTime;
+        if (distribution == "uniform") {
+            processingTime = uniformDistribution(randomEngine);
+        } else if (distribution == "exponential") {
+            processingTime = 1 + static_cast<unsigned int>(exponentialDistribution(randomEngine));
+        } else {
+            // bimodal; many small tasks with a few large ones
+            processingTime = isLargeTask(randomEngine) ? largeDistribution(randomEngine) : smallDistribution(randomEngine);
+        }
+        workload.tasks.push_back(Task(static_cast<unsigned int>(index + 1), processingTime));
+    }
+    return workload;
+}
+
+// Read a replayed workload; one task per line, either "processingTime" or "id,processingTime"
+bool readReplayedWorkload(const std::string& fileName, unsigned int numMachines, Workload& workload) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile) {
+        return false;
+    }
+
+    workload.name = "replay-" + fileName.substr(fileName.find_last_of("/\\") + 1) + "-m" + std::to_string(numMachines);
+    workload.numMachines = numMachines;
+    std::string line;
+    while (std::getline(inputFile, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::size_t commaPosition = line.find(',');
+        unsigned int id = static_cast<unsigned int>(workload.tasks.size() + 1);
+        std::string processingTimeField = line;
+        if (commaPosition != std::string::npos) {
+            id = static_cast<unsigned int>(std::strtoul(line.substr(0, commaPosition).c_str(), nullptr, 10));
+            processingTimeField = line.substr(commaPosition + 1);
+        }
+        workload.tasks.push_back(Task(id, static_cast<unsigned int>(std::strtoul(processingTimeField.c_str(), nullptr, 10))));
+    }
+
+    // The task IDs must be unique, so that a schedule can be checked task by task
+    std::vector<unsigned int> sortedIds;
+    for (const Task& task : workload.tasks) {
+        sortedIds.push_back(task.id);
+    }
+    std::sort(sortedIds.begin(), sortedIds.end());
+    return std::adjacent_find(sortedIds.begin(), sortedIds.end()) == sortedIds.end();
+}
+
+// Compute the makespan of a schedule, checking that every task is scheduled exactly once (the task IDs of a workload are unique)
+unsigned long long computeMakespan(const std::vector<std::vector<Task>>& machineTasks, const std::vector<Task>& workloadTasks, bool& valid) {
+    std::vector<unsigned int> sortedIds;
+    sortedIds.reserve(workloadTasks.size());
+    for (const Task& task : workloadTasks) {
+        sortedIds.push_back(task.id);
+    }
+    std::sort(sortedIds.begin(), sortedIds.end());
+
+    // Mark each scheduled task by the rank of its ID; an unknown or repeated ID, or an unmarked one at the end, makes the schedule invalid
+    std::vector<bool> isScheduled(sortedIds.size(), false);
+    unsigned long long makespan = 0;
+    valid = true;
+    for (const std::vector<Task>& tasks : machineTasks) {
+        unsigned long long load = 0;
+        for (const Task& task : tasks) {
+            load += task.processingTime;
+            std::vector<unsigned int>::const_iterator idPosition = std::lower_bound(sortedIds.begin(), sortedIds.end(), task.id);
+            if (idPosition == sortedIds.end() || *idPosition != task.id || isScheduled[idPosition - sortedIds.begin()]) {
+                valid = false;
+                continue;
+            }
+            isScheduled[idPosition - sortedIds.begin()] = true;
+        }
+        makespan = std::max(makespan, load);
+    }
+    valid = valid && std::find(isScheduled.begin(), isScheduled.end(), false) == isScheduled.end();
+    return makespan;
+}
+
+// Run every scheduler over a workload
+std::vector<BenchmarkResult> benchmarkWorkload(const Workload& workload) {
+    unsigned long long totalProcessingTime = 0, longestProcessingTime = 0;
+    for (const Task& task : workload.tasks) {
+        totalProcessingTime += task.processingTime;
+        longestProcessingTime = std::max<unsigned long long>(longestProcessingTime, task.processingTime);
+    }
+    const unsigned long long lowerBound = std::max((totalProcessingTime + workload.numMachines - 1) / workload.numMachines, longestProcessingTime);
+
+    // The schedulers returning std::vector<std::vector<Task>>; lptSchedulingCompact is adapted by grouping its machine IDs
+    std::vector<std::pair<std::string, std::function<std::vector<std::vector<Task>>()>>> schedulers = {
+        {"lpt", [&]() { return lptScheduling(workload.tasks, workload.numMachines); }},
+        {"lpt-compact", [&]() {
+            std::vector<unsigned int> machineIds = lptSchedulingCompact(workload.tasks, workload.numMachines);
+            std::vector<std::vector<Task>> machineTasks(workload.numMachines);
+            for (std::size_t index = 0; index < workload.tasks.size(); index++) {
+                machineTasks[machineIds[index]].push_back(workload.tasks[index]);
+            }
+            return machineTasks;
+        }},
+        {"multifit", [&]() { return multifitScheduling(workload.tasks, workload.numMachines); }},
+        {"karmarkar-karp", [&]() { return karmarkarKarpScheduling(workload.tasks, workload.numMachines); }},
+    };
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& scheduler : schedulers) {
+        auto startTime = std::chrono::steady_clock::now();
+        std::vector<std::vector<Task>> machineTasks = scheduler.second();
+        auto endTime = std::chrono::steady_clock::now();
+
+        BenchmarkResult result;
+        result.workloadName = workload.name;
+        result.schedulerName = scheduler.first;
+        result.numTasks = workload.tasks.size();
+        result.numMachines = workload.numMachines;
+        result.makespan = computeMakespan(machineTasks, workload.tasks, result.valid);
+        result.lowerBound = lowerBound;
+        result.runtimeMilliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        results.push_back(result);
+    }
+    return results;
+}
+
+int main(int argc, char* argv[]) {
+    std::string replayFileName;
+    std::string outputFormat = "csv";
+    unsigned int replayMachines = 10;
+    for (int index = 1; index < argc; index++) {
+        std::string argument = argv[index];
+        if (argument == "--replay" && index + 1 < argc) {
+            replayFileName = argv[++index];
+        } else if (argument == "--machines" && index + 1 < argc) {
+            replayMachines = static_cast<unsigned int>(std::strtoul(argv[++index], nullptr, 10));
+        } else if (argument == "--format" && index + 1 < argc) {
+            outputFormat = argv[++index];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--replay <file>] [--machines M] [--format csv|json]" << std::endl;
+            return 1;
+        }
+    }
+    if ((outputFormat != "csv" && outputFormat != "json") || replayMachines == 0) {
+        std::cerr << "The format must be csv or json, and the number of machines must be positive" << std::endl;
+        return 1;
+    }
+
+    std::vector<Workload> workloads;
+    for (const char* distribution : {"uniform", "exponential", "bimodal"}) {
+        // A few tasks per machine (where LPT is the weakest), then many tasks per machine
+        workloads.push_back(generateSyntheticWorkload(distribution, 25, 10));
+        workloads.push_back(generateSyntheticWorkload(distribution, 250, 100));
+        workloads.push_back(generateSyntheticWorkload(distribution, 1000, 10));
+        workloads.push_back(generateSyntheticWorkload(distribution, 100000, 10));
+        workloads.push_back(generateSyntheticWorkload(distribution, 10000, 100));
+    }
+    if (!replayFileName.empty()) {
+        Workload replayedWorkload;
+        if (!readReplayedWorkload(replayFileName, replayMachines, replayedWorkload)) {
+            std::cerr << "Failed to read the replayed workload: " << replayFileName << std::endl;
+            return 1;
+        }
+        workloads.push_back(replayedWorkload);
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const Workload& workload : workloads) {
+        std::vector<BenchmarkResult> workloadResults = benchmarkWorkload(workload);
+        results.insert(results.end(), workloadResults.begin(), workloadResults.end());
+    }
+
+    if (outputFormat == "csv") {
+        std::cout << "workload,scheduler,tasks,machines,makespan,lower_bound,makespan_ratio,runtime_ms,valid" << std::endl;
+        for (const BenchmarkResult& result : results) {
+            std::cout << result.workloadName << ',' << result.schedulerName << ',' << result.numTasks << ',' << result.numMachines << ','
+                      << result.makespan << ',' << result.lowerBound << ',' << static_cast<double>(result.makespan) / result.lowerBound << ','
+                      << result.runtimeMilliseconds << ',' << (result.valid ? "true" : "false") << std::endl;
+        }
+    } else {
+        std::cout << "[" << std::endl;
+        for (std::size_t index = 0; index < results.size(); index++) {
+            const BenchmarkResult& result = results[index];
+            std::cout << "  {\"workload\": \"" << result.workloadName << "\", \"scheduler\": \"" << result.schedulerName << "\""
+                      << ", \"tasks\": " << result.numTasks << ", \"machines\": " << result.numMachines
+                      << ", \"makespan\": " << result.makespan << ", \"lower_bound\": " << result.lowerBound
+                      << ", \"makespan_ratio\": " << static_cast<double>(result.makespan) / result.lowerBound
+                      << ", \"runtime_ms\": " << result.runtimeMilliseconds << ", \"valid\": " << (result.valid ? "true" : "false") << "}"
+                      << (index + 1 < results.size() ? "," : "") << std::endl;
+        }
+        std::cout << "]" << std::endl;
+    }
+
+    return 0;
+}
+
+// $ ./longest_processing_time_first_benchmark
+// workload,scheduler,tasks,machines,makespan,lower_bound,makespan_ratio,runtime_ms,valid
+// uniform-n250-m100,lpt,250,100,1356,1255,1.08048,0.049503,true
+// uniform-n250-m100,lpt-compact,250,100,1356,1255,1.08048,0.043525,true
+// uniform-n250-m100,multifit,250,100,1262,1255,1.00558,0.143591,true
+// uniform-n250-m100,karmarkar-karp,250,100,1356,1255,1.08048,0.255853,true
+// ...
+// uniform-n100000-m10,lpt,100000,10,4994041,4994041,1,14.1535,true
+// uniform-n100000-m10,lpt-compact,100000,10,4994041,4994041,1,4.61082,true
+// uniform-n100000-m10,multifit,100000,10,4994041,4994041,1,69.0676,true
+// uniform-n100000-m10,karmarkar-karp,100000,10,4994041,4994041,1,55.0475,true
+// ...
+// (The runtimes vary by machine; the makespans are deterministic)
@@ -0,0 +1,250 @@
+/**
+ * @file lpt_work_stealing_executor.cpp
+ * @brief A parallel executor running the static LPT plan (lptScheduling in longest_processing_time_first.hpp) on worker threads
+ *        Each machine of the plan becomes a worker thread with its own deque of tasks, in the LPT order (the longest first).
+ *        The processing times are only estimates, so when a worker runs out of its own tasks earlier than planned,
+ *        it steals from the back of the deque with the most remaining (estimated) load.
+ *        The busy time of each worker is recorded, so the utilization shows how well the estimate matched the real throughput.
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -pthread lpt_work_stealing_executor.cpp -o lpt_work_stealing_executor
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <exception>
+#include <stdexcept>
+#include <unordered_map>
+#include "longest_processing_time_first.hpp"
+
+// The per-worker result of an execution
+struct WorkerReport {
+    unsigned int workerId;
+    unsigned long long plannedLoad;     // The sum of the estimated processing times assigned by LPT
+    std::size_t executedTasks;          // The number of tasks executed by this worker (including the stolen ones)
+    std::size_t stolenTasks;            // The number of tasks stolen from the other workers
+    double busySeconds;                 // The time spent inside the task callables
+    double utilization;                 // busySeconds / wallSeconds
+};
+
+// The result of an execution
+struct ExecutionReport {
+    double wallSeconds;
+    std::vector<WorkerReport> workers;
+};
+
+// A parallel work-stealing executor driven by the LPT assignment
+class LptWorkStealingExecutor {
+private:
+    // A deque of task indices owned by a worker; the owner pops from the front (the longest first), and thieves steal from the back
+    struct WorkerDeque {
+        std::mutex mutex;
+        std::deque<std::size_t> taskIndices;
+        std::atomic<unsigned long long> remainingLoad;     // The estimated load left in the deque (to choose the victim to steal from)
+
+        WorkerDeque() : remainingLoad(0) {}
+    };
+
+    unsigned int numWorkers;
+
+    bool popOwnTask(WorkerDeque& workerDeque, const std::vector<Task>& tasks, std::size_t& taskIndex);
+    bool stealTask(std::vector<std::unique_ptr<WorkerDeque>>& workerDeques, unsigned int thiefId, const std::vector<Task>& tasks, std::size_t& taskIndex);
+
+public:
+    LptWorkStealingExecutor(unsigned int numWorkers) : numWorkers(numWorkers) {
+        if (numWorkers == 0) {
+            throw std::invalid_argument("At least one worker is required");
+        }
+    }
+
+    // Method to run taskCallables[i] for every tasks[i], planned by LPT with the estimated processing times of the tasks
+    // If a callable throws, the remaining tasks are still executed, and the first exception is rethrown after all workers finish
+    ExecutionReport run(const std::vector<Task>& tasks, const std::vector<std::function<void()>>& taskCallables);
+};
+
+// Pop the next task of the worker's own deque (the longest one first, as LPT planned)
+bool LptWorkStealingExecutor::popOwnTask(WorkerDeque& workerDeque, const std::vector<Task>& tasks, std::size_t& taskIndex) {
+    std::lock_guard<std::mutex> lock(workerDeque.mutex);
+    if (workerDeque.taskIndices.empty()) {
+        return false;
+    }
+    taskIndex = workerDeque.taskIndices.front();
+    workerDeque.taskIndices.pop_front();
+    workerDeque.remainingLoad -= tasks[taskIndex].processingTime;
+    return true;
+}
+
+// Steal a task from the back of the deque with the most remaining load
+// The victim is chosen without locking (the loads may be slightly stale), then the steal itself is done under the victim's lock.
+bool LptWorkStealingExecutor::stealTask(std::vector<std::unique_ptr<WorkerDeque>>& workerDeques, unsigned int thiefId,
+                                        const std::vector<Task>& tasks, std::size_t& taskIndex) {
+    while (true) {
+        unsigned int victimId = thiefId;
+        unsigned long long victimLoad = 0;
+        for (unsigned int workerId = 0; workerId < this->numWorkers; workerId++) {
+            unsigned long long remainingLoad = workerDeques[workerId]->remainingLoad.load();
+            if (workerId != thiefId && remainingLoad > victimLoad) {
+                victimId = workerId;
+                victimLoad = remainingLoad;
+            }
+        }
+
+        if (victimId == thiefId) {
+            // No load is left anywhere except (zero-time) tasks; check every deque once under the lock before giving up
+            for (unsigned int workerId = 0; workerId < this->numWorkers; workerId++) {
+                WorkerDeque& victimDeque = *workerDeques[workerId];
+                std::lock_guard<std::mutex> lock(victimDeque.mutex);
+                if (workerId != thiefId && !victimDeque.taskIndices.empty()) {
+                    taskIndex = victimDeque.taskIndices.back();
+                    victimDeque.taskIndices.pop_back();
+                    victimDeque.remainingLoad -= tasks[taskIndex].processingTime;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        WorkerDeque& victimDeque = *workerDeques[victimId];
+        std::lock_guard<std::mutex> lock(victimDeque.mutex);
+        if (!victimDeque.taskIndices.empty()) {
+            taskIndex = victimDeque.taskIndices.back();
+            victimDeque.taskIndices.pop_back();
+            victimDeque.remainingLoad -= tasks[taskIndex].processingTime;
+            return true;
+        }
+        // The victim has been drained in the meantime; choose another one
+    }
+}
+
+// Method to run the tasks on the worker threads, following the LPT plan and stealing when the estimates diverge
+ExecutionReport LptWorkStealingExecutor::run(const std::vector<Task>& tasks, const std::vector<std::function<void()>>& taskCallables) {
+    if (tasks.size() != taskCallables.size()) {
+        throw std::invalid_argument("Every task needs exactly one callable");
+    }
+
+    // Map the task IDs back to their indices, since lptScheduling returns copies of the tasks
+    std::unordered_map<unsigned int, std::size_t> taskIndexById;
+    for (std::size_t index = 0; index < tasks.size(); index++) {
+        if (!taskIndexById.insert({tasks[index].id, index}).second) {
+            throw std::invalid_argument("Task IDs must be unique");
+        }
+    }
+
+    // Fill the deques with the LPT plan; each machine's tasks are already in descending order of processing times
+    std::vector<std::vector<Task>> plan = lptScheduling(tasks, this->numWorkers);
+    std::vector<std::unique_ptr<WorkerDeque>> workerDeques;
+    ExecutionReport report;
+    report.workers.resize(this->numWorkers);
+    for (unsigned int workerId = 0; workerId < this->numWorkers; workerId++) {
+        workerDeques.emplace_back(new WorkerDeque());
+        unsigned long long plannedLoad = 0;
+        for (const Task& task : plan[workerId]) {
+            workerDeques[workerId]->taskIndices.push_back(taskIndexById[task.id]);
+            plannedLoad += task.processingTime;
+        }
+        workerDeques[workerId]->remainingLoad = plannedLoad;
+        report.workers[workerId] = WorkerReport{workerId, plannedLoad, 0, 0, 0.0, 0.0};
+    }
+
+    std::mutex exceptionMutex;
+    std::exception_ptr firstException;
+    auto workerLoop = [&](unsigned int workerId) {
+        WorkerReport& workerReport = report.workers[workerId];
+        std::size_t taskIndex = 0;
+        while (true) {
+            bool stolen = false;
+            if (!popOwnTask(*workerDeques[workerId], tasks, taskIndex)) {
+                if (!stealTask(workerDeques, workerId, tasks, taskIndex)) {
+                    break;      // No task spawns another task, so nothing will appear again once every deque is empty
+                }
+                stolen = true;
+            }
+
+            auto startTime = std::chrono::steady_clock::now();
+            try {
+                taskCallables[taskIndex]();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!firstException) {
+                    firstException = std::current_exception();
+                }
+            }
+            auto endTime = std::chrono::steady_clock::now();
+
+            workerReport.busySeconds += std::chrono::duration<double>(endTime - startTime).count();
+            workerReport.executedTasks++;
+            workerReport.stolenTasks += stolen ? 1 : 0;
+        }
+    };
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned int workerId = 0; workerId < this->numWorkers; workerId++) {
+        workers.emplace_back(workerLoop, workerId);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    report.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    for (WorkerReport& workerReport : report.workers) {
+        workerReport.utilization = (report.wallSeconds > 0) ? workerReport.busySeconds / report.wallSeconds : 0.0;
+    }
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+    return report;
+}
+
+int main() {
+    // The same tasks as longest_processing_time_first.cpp; the processing times are the estimates in milliseconds
+    std::vector<Task> tasks = {
+        Task(1, 10),
+        Task(2, 5),
+        Task(3, 15),
+        Task(4, 7),
+        Task(5, 3),
+        Task(6, 8),
+        Task(7, 12),
+        Task(8, 6),
+        Task(9, 9),
+        Task(10, 4),
+    };
+
+    // The actual runtimes diverge from the estimates; task 3 takes 4 times longer, and task 7 finishes almost immediately
+    std::vector<std::function<void()>> taskCallables;
+    for (const Task& task : tasks) {
+        unsigned int actualMilliseconds = task.processingTime;
+        if (task.id == 3) actualMilliseconds *= 4;
+        if (task.id == 7) actualMilliseconds = 1;
+        taskCallables.push_back([actualMilliseconds]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(actualMilliseconds));
+        });
+    }
+
+    LptWorkStealingExecutor executor(3);
+    ExecutionReport report = executor.run(tasks, taskCallables);
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Wall time: " << report.wallSeconds << "s" << std::endl;
+    for (const WorkerReport& workerReport : report.workers) {
+        std::cout << "Worker " << workerReport.workerId + 1 << ": planned load " << workerReport.plannedLoad
+                  << ", executed " << workerReport.executedTasks << " tasks (" << workerReport.stolenTasks << " stolen)"
+                  << ", busy " << workerReport.busySeconds << "s, utilization " << workerReport.utilization << std::endl;
+    }
+
+    return 0;
+}
+
+// (The timings vary by run and machine)
+// Wall time: 0.062s
+// Worker 1: planned load 26, executed 1 tasks (0 stolen), busy 0.060s, utilization 0.965
+// Worker 2: planned load 25, executed 6 tasks (3 stolen), busy 0.029s, utilization 0.459
+// Worker 3: planned load 28, executed 3 tasks (0 stolen), busy 0.025s, utilization 0.405
@@ -2,6 +2,8 @@
  * @file max_heap_sort.cpp
  * @brief C++ Program to implement Max Heap Sort Algorithm
  *        To be simple, we use <queue> to implement the max heap sort algorithm.
+ *        In-place (allocation-free) heap sort, top-k partial sort and introsort (with the heap sort as its fallback)
+ *        over random access iterators are also provided, for inputs too large to be copied.
  */
 //
 
@@ -9,6 +11,9 @@
 #include <queue>
 #include <vector>
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
 
 // A helper method to display the elements of the priority queue
 template <typename PriorityQueueElementType>
@@ -53,6 +58,148 @@ std::vector<PriorityQueueElementType> priorityQueueSortAscending(std::vector<Pri
     return sortedElements;
 }
 
+// A helper method to sift the element at holeIndex down the max heap [first, first + heapSize) (bottom-up, Floyd's method)
+// Instead of comparing the element against both children at every level (2 comparisons per level),
+// the hole is first moved down to a leaf along the larger children (1 comparison per level),
+// then the element is sifted up from there, which is usually only a level or two since it came from the bottom of the heap.
+template <typename RandomAccessIterator, typename Compare>
+void bottomUpSiftDown(RandomAccessIterator first, typename std::iterator_traits<RandomAccessIterator>::difference_type holeIndex,
+                      typename std::iterator_traits<RandomAccessIterator>::difference_type heapSize,
+                      typename std::iterator_traits<RandomAccessIterator>::value_type element, Compare compare) {
+    using DifferenceType = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    const DifferenceType topIndex = holeIndex;
+
+    // Move the hole down to a leaf, always promoting the larger child
+    DifferenceType childIndex = 2 * holeIndex + 1;
+    while (childIndex < heapSize) {
+        if (childIndex + 1 < heapSize && compare(first[childIndex], first[childIndex + 1])) {
+            childIndex++;
+        }
+        first[holeIndex] = std::move(first[childIndex]);
+        holeIndex = childIndex;
+        childIndex = 2 * holeIndex + 1;
+    }
+
+    // Sift the element up from the leaf (not above where the hole started)
+    while (holeIndex > topIndex) {
+        DifferenceType parentIndex = (holeIndex - 1) / 2;
+        if (!compare(first[parentIndex], element)) {
+            break;
+        }
+        first[holeIndex] = std::move(first[parentIndex]);
+        holeIndex = parentIndex;
+    }
+    first[holeIndex] = std::move(element);
+}
+
+// A helper method to build a max heap in place over [first, last) in O(n) (Floyd's heapify; sift down every internal node from the bottom)
+template <typename RandomAccessIterator, typename Compare>
+void makeMaxHeapInPlace(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+    auto heapSize = last - first;
+    for (auto index = heapSize / 2; index-- > 0;) {
+        bottomUpSiftDown(first, index, heapSize, std::move(first[index]), compare);
+    }
+}
+
+// A helper method to sort the max heap [first, last) in place; the maximum is repeatedly swapped to the end of the shrinking heap
+template <typename RandomAccessIterator, typename Compare>
+void sortMaxHeapInPlace(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
+    for (auto heapSize = last - first; heapSize > 1; heapSize--) {
+        auto lastElement = std::move(first[heapSize - 1]);
+        first[heapSize - 1] = std::move(first[0]);
+        bottomUpSiftDown(first, 0, heapSize - 1, std::move(lastElement), compare);
+    }
+}
+
+// In-place heap sort over random access iterators, in ascending order of the comparator (descending with std::greater)
+// No extra memory is allocated, so sorting 100M integers needs nothing but the integers themselves. O(n log n) in the worst case.
+template <typename RandomAccessIterator, typename Compare = std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>>
+void heapSortInPlace(RandomAccessIterator first, RandomAccessIterator last, Compare compare = Compare()) {
+    makeMaxHeapInPlace(first, last, compare);
+    sortMaxHeapInPlace(first, last, compare);
+}
+
+// In-place partial heap sort (top-k); only the k = (middle - first) smallest elements are extracted into [first, middle) in ascending order,
+// and the rest are left in [middle, last) in an unspecified order. (The same contract as std::partial_sort)
+// A max heap of the k candidates is kept in [first, middle), so every other element costs a single comparison against the root
+// unless it is smaller than the root. O(n log k) instead of O(n log n), and no extra memory.
+template <typename RandomAccessIterator, typename Compare = std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>>
+void heapPartialSortInPlace(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare compare = Compare()) {
+    if (first == middle) {
+        return;
+    }
+    makeMaxHeapInPlace(first, middle, compare);
+    for (RandomAccessIterator current = middle; current != last; ++current) {
+        if (compare(*current, *first)) {
+            // The current element replaces the largest candidate at the root
+            auto element = std::move(*current);
+            *current = std::move(*first);
+            bottomUpSiftDown(first, 0, middle - first, std::move(element), compare);
+        }
+    }
+    sortMaxHeapInPlace(first, middle, compare);
+}
+
+// A helper method of introSort; quicksort with the median-of-three pivot until the recursion gets too deep,
+// then the remaining range is heap sorted so that the worst case stays O(n log n)
+template <typename RandomAccessIterator, typename Compare>
+void introSortLoop(RandomAccessIterator first, RandomAccessIterator last, unsigned int depthLimit, Compare compare) {
+    const long INSERTION_SORT_THRESHOLD = 16;
+    while (last - first > INSERTION_SORT_THRESHOLD) {
+        if (depthLimit == 0) {
+            // Too many unbalanced partitions (e.g. adversarial input); fall back to the heap sort
+            heapSortInPlace(first, last, compare);
+            return;
+        }
+        depthLimit--;
+
+        // Move the median of the first, middle and last elements to the first position as the pivot
+        RandomAccessIterator middle = first + (last - first) / 2;
+        RandomAccessIterator lastElement = last - 1;
+        if (compare(*middle, *first)) std::iter_swap(middle, first);
+        if (compare(*lastElement, *middle)) std::iter_swap(lastElement, middle);
+        if (compare(*middle, *first)) std::iter_swap(middle, first);
+        std::iter_swap(first, middle);
+
+        // Hoare partition around the pivot (at first)
+        RandomAccessIterator left = first + 1, right = last;
+        while (true) {
+            while (compare(*left, *first)) ++left;
+            --right;
+            while (compare(*first, *right)) --right;
+            if (!(left < right)) break;
+            std::iter_swap(left, right);
+            ++left;
+        }
+
+        // Recurse into the right part, and loop over the left part
+        introSortLoop(left, last, depthLimit, compare);
+        last = left;
+    }
+}
+
+// Introsort (the std::sort strategy); quicksort, with the in-place heap sort as the fallback against the quadratic worst case,
+// and the insertion sort to finish the small ranges
+template <typename RandomAccessIterator, typename Compare = std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>>
+void introSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare = Compare()) {
+    unsigned int depthLimit = 0;
+    for (auto size = last - first; size > 1; size /= 2) {
+        depthLimit += 2;
+    }
+    introSortLoop(first, last, depthLimit, compare);
+
+    // Insertion sort over the nearly sorted range (every element is at most 16 positions away from its place)
+    for (RandomAccessIterator current = first; current != last; ++current) {
+        auto element = std::move(*current);
+        RandomAccessIterator hole = current;
+        while (hole != first && compare(element, *(hole - 1))) {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        }
+        *hole = std::move(element);
+    }
+}
+
 // A helper method to simply display the elements of a vector
 template <typename VectorElementType>
 void displayVector(std::vector<VectorElementType> elements) {
@@ -76,9 +223,30 @@ int main(void) {
     std::vector<int> sortedElementsAscending = priorityQueueSortAscending(elements);
     displayVector(sortedElementsAscending);
 
+    // Sort the elements in place (no copy, no allocation) in ascending and descending order
+    std::vector<int> inPlaceElements = elements;
+    heapSortInPlace(inPlaceElements.begin(), inPlaceElements.end());
+    displayVector(inPlaceElements);
+    heapSortInPlace(inPlaceElements.begin(), inPlaceElements.end(), std::greater<int>());
+    displayVector(inPlaceElements);
+
+    // Extract only the top 3 (the largest 3 in descending order)
+    std::vector<int> topKElements = elements;
+    heapPartialSortInPlace(topKElements.begin(), topKElements.begin() + 3, topKElements.end(), std::greater<int>());
+    displayVector(std::vector<int>(topKElements.begin(), topKElements.begin() + 3));
+
+    // Introsort with the heap sort as its fallback
+    std::vector<int> introSortedElements = elements;
+    introSort(introSortedElements.begin(), introSortedElements.end());
+    displayVector(introSortedElements);
+
     return 0;
 }
 
 // Vector elements: 5 3 8 4 1 2 9 7 6 
 // Vector elements: 9 8 7 6 5 4 3 2 1
+// Vector elements: 1 2 3 4 5 6 7 8 9
+// Vector elements: 1 2 3 4 5 6 7 8 9
+// Vector elements: 9 8 7 6 5 4 3 2 1
+// Vector elements: 9 8 7
 // Vector elements: 1 2 3 4 5 6 7 8 9
\ No newline at end of file
@@ -0,0 +1,170 @@
+/**
+ * @file priority_queue_via_max_heap_array.hpp
+ * @brief C++ Program to implement Priority Queue using Max Heap
+ *        It is shared by priority_queue_via_max_heap_array.cpp (example) and the other programs built on the array heap.
+ */
+
+#ifndef PRIORITY_QUEUE_VIA_MAX_HEAP_ARRAY_HPP
+#define PRIORITY_QUEUE_VIA_MAX_HEAP_ARRAY_HPP
+
+#include <iostream>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+
+// The element with the highest priority is the largest one by Compare (std::less by default, so it is a max heap)
+// With an inverted comparator such as std::greater, the same class works as a min heap.
+template <typename PriorityQueueElementType, typename Compare = std::less<PriorityQueueElementType>>
+class PriorityQueueViaMaxHeapArray {
+private:
+    std::vector<PriorityQueueElementType> maxHeapArray;
+    unsigned int size = 0;
+    Compare compare;                                // compare(a, b) is true if a has a lower priority than b
+
+    void heapifyUp(unsigned int index);             // Helper method to maintain the heap property after insertion
+    void heapifyDown(unsigned int index);           // Helper method to maintain the heap property after removal
+    
+public:
+    PriorityQueueViaMaxHeapArray(Compare compare = Compare()) : compare(compare) {}
+
+    void reserve(unsigned int capacity) { maxHeapArray.reserve(capacity); }  // Method to preallocate the array (no reallocation while inserting)
+    void insert(PriorityQueueElementType data);     // Method to insert an element into the priority queue
+    void replaceMax(PriorityQueueElementType data); // Method to replace the element with the highest priority with a new one (a remove and an insert in one sift)
+    PriorityQueueElementType remove();              // Method to remove the element with the highest priority (highest value) from the priority queue
+    PriorityQueueElementType getMax();              // Method to get the element with the highest priority (highest value) from the priority queue
+    PriorityQueueElementType getMin();              // Method to get the element with the lowest priority (lowest value) from the priority queue
+    unsigned int getSize();                         // Method to get the this->size of the priority queue
+    const std::vector<PriorityQueueElementType>& getElements() const { return maxHeapArray; }   // Method to get the elements (in the heap array order)
+    void display();                                 // Method to display the elements of the priority queue via level order traversal
+};
+
+// Method to insert an element into the priority queue
+template <typename PriorityQueueElementType, typename Compare>
+void PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::insert(PriorityQueueElementType data) {
+    maxHeapArray.push_back(data);
+    this->size++;
+    heapifyUp(this->size - 1);
+}
+
+// Helper method to maintain the heap property after insertion
+template <typename PriorityQueueElementType, typename Compare>
+void PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::heapifyUp(unsigned int index) {
+    while (index > 0) {
+        // Note that the max heap is implemented as an array, so the parent index can be calculated as (index - 1) / 2
+        unsigned int parentIndex = (index - 1) / 2;
+        // If the parent node is less than the current node, swap them to maintain the max heap property
+        if (compare(maxHeapArray[parentIndex], maxHeapArray[index])) {
+            std::swap(maxHeapArray[parentIndex], maxHeapArray[index]);
+            index = parentIndex;
+        } else {
+            break;
+        }
+    }
+}
+
+// Method to remove the element with the highest priority (highest value) from the priority queue
+template <typename PriorityQueueElementType, typename Compare>
+PriorityQueueElementType PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::remove() {
+    if (this->size == 0) {
+        throw std::out_of_range("Priority Queue is empty");
+    }
+
+    // The element with the highest priority is always the root of the max heap
+    // So, removing the root element will be removing the first element of the array
+    PriorityQueueElementType removedElement = maxHeapArray[0];
+    maxHeapArray[0] = maxHeapArray[this->size - 1];                 // Replace the root with the last element of the array
+    maxHeapArray.pop_back();                                        // Remove the last element of the array (which was the root)
+    this->size--;
+
+    // Maintain the heap property after removal
+    // Note that the root element is replaced with the last element of the array (which was the last element of the max heap)
+    heapifyDown(0);
+    return removedElement;
+}
+
+// Method to replace the element with the highest priority with a new one
+// It is cheaper than remove() followed by insert(), since the new element is placed at the root and sifted down only once
+template <typename PriorityQueueElementType, typename Compare>
+void PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::replaceMax(PriorityQueueElementType data) {
+    if (this->size == 0) {
+        throw std::out_of_range("Priority Queue is empty");
+    }
+    maxHeapArray[0] = data;
+    heapifyDown(0);
+}
+
+// Helper method to maintain the heap property after removal
+template <typename PriorityQueueElementType, typename Compare>
+void PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::heapifyDown(unsigned int index) {
+    while (index < this->size) {
+        // Note that the max heap is implemented as an array, so the left child index can be calculated as 2 * index + 1
+        unsigned int leftChildIndex = 2 * index + 1;
+        unsigned int rightChildIndex = 2 * index + 2;
+        unsigned int maxIndex = index;                      // Assume the current node is the largest
+
+        if (leftChildIndex < this->size && compare(maxHeapArray[maxIndex], maxHeapArray[leftChildIndex])) {
+            // If the left child is greater than the current node, update the max index
+            maxIndex = leftChildIndex;
+        }
+        if (rightChildIndex < this->size && compare(maxHeapArray[maxIndex], maxHeapArray[rightChildIndex])) {
+            // If the right child is greater than the current node, update the max index
+            maxIndex = rightChildIndex;
+        }
+        if (maxIndex == index) {
+            // If the current node is the largest, we don't need to do anything because the max heap property is maintained
+            break;
+        } else {
+            // Otherwise, swap the current node with the largest child
+            std::swap(maxHeapArray[index], maxHeapArray[maxIndex]);
+            index = maxIndex;
+        }
+    }
+}
+
+// Method to get the element with the highest priority (highest value) from the priority queue
+template <typename PriorityQueueElementType, typename Compare>
+PriorityQueueElementType PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::getMax() {
+    if (this->size == 0) {
+        throw std::out_of_range("Priority Queue is empty");
+    }
+
+    // The element with the highest priority is always the root of the max heap
+    return maxHeapArray[0];
+}
+
+// Method to get the element with the lowest priority (lowest value) from the priority queue
+template <typename PriorityQueueElementType, typename Compare>
+PriorityQueueElementType PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::getMin() {
+    if (this->size == 0) {
+        throw std::out_of_range("Priority Queue is empty");
+    }
+    
+    // We just need to iterate through the max heap array to find the minimum element
+    PriorityQueueElementType minElement = maxHeapArray[0];
+    for (const auto& element : maxHeapArray) {
+        if (compare(element, minElement)) {
+            minElement = element;
+        }
+    }
+    return minElement;
+}
+
+// Method to get the this->size of the priority queue
+template <typename PriorityQueueElementType, typename Compare>
+unsigned int PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::getSize() {
+    return this->size;
+}
+
+// Method to display the elements of the priority queue via level order traversal
+template <typename PriorityQueueElementType, typename Compare>
+void PriorityQueueViaMaxHeapArray<PriorityQueueElementType, Compare>::display() {
+    if (this->size == 0) {
+        throw std::out_of_range("Priority Queue is empty");
+    }
+    for (unsigned int index = 0; index < this->size; index++) {
+        std::cout << maxHeapArray[index] << " ";
+    }
+    std::cout << std::endl;
+}
+
+#endif // PRIORITY_QUEUE_VIA_MAX_HEAP_ARRAY_HPP
@@ -0,0 +1,202 @@
+/**
+ * @file top_k_streaming_selector.cpp
+ * @brief C++ Program to select the top K elements of a huge stream with a bounded heap
+ *        Built on the array heap of priority_queue_via_max_heap_array.hpp; instead of materializing every element in a heap
+ *        (as max_heap_sort.cpp does), only the best K elements seen so far are kept in a heap of size K whose root is the worst of them.
+ *        So, most elements are rejected by a single comparison against the root, and the memory is O(K) no matter how long the stream is.
+ *        Partial results of multiple threads can be merged, and batches can be pre-filtered with SIMD (AVX2 when available).
+ *
+ *        Build & Run: g++ -std=c++11 -O2 -mavx2 -pthread top_k_streaming_selector.cpp -o top_k_streaming_selector
+ */
+//
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <random>
+#include <cstddef>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "priority_queue_via_max_heap_array.hpp"
+
+// A helper method telling whether a batch may contain an element better than the threshold (compare(threshold, element) is true)
+// The loop has no early exit and no branch, so the compiler can vectorize it.
+template <typename TopKElementType, typename Compare>
+bool batchMayContainCandidate(const TopKElementType* values, std::size_t count, const TopKElementType& threshold, const Compare& compare) {
+    bool found = false;
+    for (std::size_t index = 0; index < count; index++) {
+        found |= compare(threshold, values[index]);
+    }
+    return found;
+}
+
+#ifdef __AVX2__
+// AVX2 version for int scores compared by std::less; 8 elements are compared against the threshold at once
+inline bool batchMayContainCandidate(const int* values, std::size_t count, const int& threshold, const std::less<int>&) {
+    __m256i thresholds = _mm256_set1_epi32(threshold);
+    __m256i found = _mm256_setzero_si256();
+    std::size_t index = 0;
+    for (; index + 8 <= count; index += 8) {
+        __m256i batch = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+        found = _mm256_or_si256(found, _mm256_cmpgt_epi32(batch, thresholds));
+    }
+    bool foundInTail = false;
+    for (; index < count; index++) {
+        foundInTail |= (threshold < values[index]);
+    }
+    return !_mm256_testz_si256(found, found) || foundInTail;
+}
+#endif
+
+// A top-K selector keeping the K best (the largest by Compare) elements of a stream
+template <typename TopKElementType, std::size_t K, typename Compare = std::less<TopKElementType>>
+class TopK {
+private:
+    // The heap must put the worst kept element at the root, so the comparator is inverted (a "min heap" of the array heap)
+    struct InvertedCompare {
+        Compare compare;
+        bool operator()(const TopKElementType& a, const TopKElementType& b) const { return compare(b, a); }
+    };
+
+    static const std::size_t PREFILTER_BATCH_SIZE = 64;
+
+    PriorityQueueViaMaxHeapArray<TopKElementType, InvertedCompare> heap;
+    Compare compare;
+
+public:
+    TopK(Compare compare = Compare()) : heap(InvertedCompare{compare}), compare(compare) {
+        static_assert(K > 0, "K must be positive");
+        heap.reserve(static_cast<unsigned int>(K));
+    }
+
+    bool offer(const TopKElementType& element);                         // Method to offer an element, returning whether it is kept (for now)
+    void offerBatch(const TopKElementType* elements, std::size_t count); // Method to offer a batch of elements with the pre-filter
+    void merge(const TopK& other);                                      // Method to merge the partial result of another selector (e.g. another thread)
+    std::size_t getSize() const { return heap.getElements().size(); }
+    std::vector<TopKElementType> getSorted() const;                     // Method to get the kept elements, the best first
+};
+
+// Method to offer an element, returning whether it is kept (for now)
+template <typename TopKElementType, std::size_t K, typename Compare>
+bool TopK<TopKElementType, K, Compare>::offer(const TopKElementType& element) {
+    if (getSize() < K) {
+        heap.insert(element);
+        return true;
+    }
+
+    // The only comparison for most elements of a long stream; anything not better than the worst kept one is rejected
+    if (!compare(heap.getElements()[0], element)) {
+        return false;
+    }
+    heap.replaceMax(element);
+    return true;
+}
+
+// Method to offer a batch of elements
+// Once the heap is full, each chunk of the batch is first checked against the current threshold (the root) with SIMD,
+// and only the chunks that may contain a better element are offered one by one.
+template <typename TopKElementType, std::size_t K, typename Compare>
+void TopK<TopKElementType, K, Compare>::offerBatch(const TopKElementType* elements, std::size_t count) {
+    std::size_t index = 0;
+    for (; index < count && getSize() < K; index++) {
+        offer(elements[index]);
+    }
+
+    while (index < count) {
+        std::size_t chunkSize = (count - index < PREFILTER_BATCH_SIZE) ? count - index : PREFILTER_BATCH_SIZE;
+        if (batchMayContainCandidate(elements + index, chunkSize, heap.getElements()[0], compare)) {
+            for (std::size_t chunkIndex = index; chunkIndex < index + chunkSize; chunkIndex++) {
+                offer(elements[chunkIndex]);
+            }
+        }
+        index += chunkSize;
+    }
+}
+
+// Method to merge the partial result of another selector; the top K of the union is the top K of the two top K's
+template <typename TopKElementType, std::size_t K, typename Compare>
+void TopK<TopKElementType, K, Compare>::merge(const TopK& other) {
+    for (const TopKElementType& element : other.heap.getElements()) {
+        offer(element);
+    }
+}
+
+// Method to get the kept elements, the best first
+template <typename TopKElementType, std::size_t K, typename Compare>
+std::vector<TopKElementType> TopK<TopKElementType, K, Compare>::getSorted() const {
+    std::vector<TopKElementType> sortedElements = heap.getElements();
+    Compare compare = this->compare;
+    std::sort(sortedElements.begin(), sortedElements.end(), [&compare](const TopKElementType& a, const TopKElementType& b) {
+        return compare(b, a);
+    });
+    return sortedElements;
+}
+
+// A helper method to simply display the elements of a vector
+template <typename VectorElementType>
+void displayVector(const std::vector<VectorElementType>& elements) {
+    for (const VectorElementType& element : elements) {
+        std::cout << element << " ";
+    }
+    std::cout << std::endl;
+}
+
+int main(void) {
+    // A stream of 4M scores (with a fixed seed)
+    std::mt19937 randomEngine(42);
+    std::vector<int> scores(4000000);
+    for (int& score : scores) {
+        score = static_cast<int>(randomEngine() % 1000000000);
+    }
+
+    // One element at a time
+    TopK<int, 5> topK;
+    for (int score : scores) {
+        topK.offer(score);
+    }
+    std::cout << "Top 5 (offer): ";
+    displayVector(topK.getSorted());
+
+    // Batches with the SIMD pre-filter
+    TopK<int, 5> batchTopK;
+    batchTopK.offerBatch(scores.data(), scores.size());
+    std::cout << "Top 5 (offerBatch): ";
+    displayVector(batchTopK.getSorted());
+
+    // 4 threads, each with its own selector over a quarter of the stream, then merged
+    const unsigned int numThreads = 4;
+    std::vector<TopK<int, 5>> partialTopKs(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned int threadIndex = 0; threadIndex < numThreads; threadIndex++) {
+        threads.emplace_back([&, threadIndex]() {
+            std::size_t begin = scores.size() * threadIndex / numThreads;
+            std::size_t end = scores.size() * (threadIndex + 1) / numThreads;
+            partialTopKs[threadIndex].offerBatch(scores.data() + begin, end - begin);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    TopK<int, 5> mergedTopK;
+    for (const TopK<int, 5>& partialTopK : partialTopKs) {
+        mergedTopK.merge(partialTopK);
+    }
+    std::cout << "Top 5 (merged from threads): ";
+    displayVector(mergedTopK.getSorted());
+
+    // The bottom 3 with an inverted comparator
+    TopK<int, 3, std::greater<int>> bottomK;
+    bottomK.offerBatch(scores.data(), scores.size());
+    std::cout << "Bottom 3: ";
+    displayVector(bottomK.getSorted());
+
+    return 0;
+}
+
+// Top 5 (offer): 999999945 999999726 999999587 999999000 999998906
+// Top 5 (offerBatch): 999999945 999999726 999999587 999999000 999998906
+// Top 5 (merged from threads): 999999945 999999726 999999587 999999000 999998906
+// Bottom 3: 614 618 938